@@ -0,0 +1,80 @@
+#pragma once
+
+#include <stdexcept>
+#include <utility>
+
+/// @brief BinaryHeap class: array-backed binary heap (priority queue). Push and pop take O(log n); peeking at the top takes O(1).
+/// The order is given by a comparison function: the element that comes "before" all others is at the top.
+/// Elements that compare equal come out in no particular order, so the comparison should break ties if that matters.
+/// @tparam T Template for use of generic data. Must be default constructible and movable.
+template <typename T>
+class BinaryHeap {
+  public:
+    /// @brief Comparison function: returns true if a must come out before b.
+    typedef bool (*Comparison)(const T& a, const T& b);
+
+  private:
+    T* elements;
+    int size;
+    int capacity;
+    Comparison before;
+
+    /// @brief Helper method to grow the array to twice its capacity.
+    void grow();
+    /// @brief Helper method to move an element up until its parent comes before it.
+    /// @param index The index of the element.
+    void siftUp(int index);
+    /// @brief Helper method to move an element down until it comes before both of its children.
+    /// @param index The index of the element.
+    void siftDown(int index);
+    /// @brief Default comparison: operator<, so the smallest element is at the top.
+    static bool lessThan(const T& a, const T& b);
+
+  public:
+    /// @brief BinaryHeap constructor. The smallest element (by operator<) is at the top.
+    BinaryHeap();
+    /// @brief BinaryHeap parameterized constructor.
+    /// @param newBefore The comparison function that decides which element is at the top.
+    explicit BinaryHeap(Comparison newBefore);
+    /// @brief BinaryHeap copy constructor.
+    /// @param other The other heap to be copied into this one.
+    BinaryHeap(const BinaryHeap& other);
+    /// @brief BinaryHeap copy assignment operator.
+    /// @param other The other heap to be copied into this one.
+    /// @return This heap with the copied data.
+    BinaryHeap& operator=(const BinaryHeap& other);
+    /// @brief BinaryHeap destructor.
+    ~BinaryHeap();
+
+    /// @brief Inserts a copy of some data.
+    /// @param data The data to be inserted.
+    void push(const T& data);
+    /// @brief Inserts some data by moving it.
+    /// @param data The data to be inserted.
+    void push(T&& data);
+    /// @brief Removes the element at the top. Throws std::out_of_range if the heap is empty.
+    /// @return The removed element.
+    T pop();
+    /// @brief Gets the element at the top without removing it. Throws std::out_of_range if the heap is empty.
+    /// @return A reference to the element. Changing its order breaks the heap.
+    T& top();
+    /// @brief Removes the first element equal (operator==) to some data. Takes O(n) to find it.
+    /// @param data The data to be removed.
+    /// @return True if an element was removed; false otherwise.
+    bool remove(const T& data);
+    /// @brief Gets an element by its position in the underlying array, to scan every element in no particular order.
+    /// Throws std::out_of_range if the index is not between 0 and getSize() - 1.
+    /// @param index The position of the element.
+    /// @return A constant reference to the element.
+    const T& at(int index) const;
+    /// @brief Removes every element.
+    void clear();
+    /// @brief Gets the amount of elements in the heap.
+    /// @return The amount of elements.
+    int getSize() const;
+    /// @brief Checks if the heap is empty.
+    /// @return True if it has no elements; false otherwise.
+    bool isEmpty() const;
+};
+
+#include <binaryHeap.tpp>
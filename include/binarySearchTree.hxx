@@ -1,5 +1,10 @@
 #pragma once
 
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <utility>
+
 /// @brief BinarySearchTreeNode class for use in a binary search tree. Contains some data, and pointers to its two children nodes.
 /// @tparam T Template for use of generic data. 
 template <typename T>
@@ -11,11 +16,19 @@ class BinarySearchTreeNode {
 
     template <typename U>
     friend class BinarySearchTree;
+    template <typename U, typename V, bool Reverse>
+    friend class BinarySearchTreeIterator;
+
+    /// @brief A node still to be copied by the iterative copy constructor, and the copy whose children it fills.
+    struct CopyTask {
+      const BinarySearchTreeNode* source;
+      BinarySearchTreeNode* copy;
+    };
 
   public:
     /// @brief BinarySearchTreeNode constructor.
     BinarySearchTreeNode();
-    /// @brief BinarySearchTreeNode copy constructor.
+    /// @brief BinarySearchTreeNode copy constructor. Copies the whole sub-tree iteratively, so deep trees don't overflow the call stack.
     /// @param other The other BSTNode to copy.
     BinarySearchTreeNode(const BinarySearchTreeNode& other);
 		/// @brief BinarySearchTreeNode move constructor.
@@ -27,7 +40,14 @@ class BinarySearchTreeNode {
 		BinarySearchTreeNode& operator=(BinarySearchTreeNode&& other);
     /// @brief BinarySearchTreeNode parameterized constructor.
     /// @param newData The new data to be stored in the node's data attribute.
-    BinarySearchTreeNode(T newData);
+    BinarySearchTreeNode(const T& newData);
+    /// @brief BinarySearchTreeNode parameterized constructor that moves the data into the node.
+    /// @param newData The data to be moved into the node's data attribute.
+    BinarySearchTreeNode(T&& newData);
+    /// @brief BinarySearchTreeNode emplacing constructor: builds the data in place from the constructor arguments of T.
+    /// @param args The arguments forwarded to T's constructor.
+    template <typename... Args>
+    BinarySearchTreeNode(std::in_place_t, Args&&... args);
     
 		/// @brief Gets the node's data
 		/// @return The node's data
@@ -36,47 +56,128 @@ class BinarySearchTreeNode {
 		/// @return A pointer to the node's data.
 		T* getPData();
     /// @brief Overload of comparison operator == to check if two BST Nodes are the same (their data is the same, and all of their children are equal).
+    /// Compares iteratively, so deep trees don't overflow the call stack.
     /// @param otherNode The other node to compare with.
     /// @return True if the nodes are equal; false otherwise.
     bool operator==(const BinarySearchTreeNode& otherNode) const;
 };
 
-/// @brief BinarySearchTree class: implementation of a binary search tree. Contains a pointer to its root as an attribute.
+/// @brief BinarySearchTreeStack class: growable array stack used by the tree's iterative algorithms and iterators instead of the call stack.
+/// @tparam E The type of the stacked elements.
+template <typename E>
+class BinarySearchTreeStack {
+  private:
+    E* items;
+    int top;
+    int capacity;
+
+  public:
+    /// @brief BinarySearchTreeStack constructor. Doesn't allocate until the first push.
+    BinarySearchTreeStack();
+    /// @brief BinarySearchTreeStack copy constructor.
+    /// @param other The stack to copy.
+    BinarySearchTreeStack(const BinarySearchTreeStack& other);
+    /// @brief BinarySearchTreeStack assignment operator.
+    /// @param other The stack to copy.
+    /// @return This stack.
+    BinarySearchTreeStack& operator=(const BinarySearchTreeStack& other);
+    /// @brief BinarySearchTreeStack destructor.
+    ~BinarySearchTreeStack();
+
+    /// @brief Pushes an element, growing the stack when needed.
+    /// @param item The element to push.
+    void push(const E& item);
+    /// @brief Removes the top element.
+    /// @return The removed element.
+    E pop();
+    /// @brief Gets the top element without removing it.
+    /// @return The top element.
+    const E& peek() const;
+    /// @brief Checks if the stack is empty.
+    /// @return True if it is empty; false otherwise.
+    bool isEmpty() const;
+};
+
+/// @brief BinarySearchTreeIterator class: STL-style forward iterator that visits a binary search tree in order.
+/// Keeps the path to the current node in an explicit stack, so a full traversal is O(n) and uses O(height) memory.
+/// @tparam T The type stored in the tree.
+/// @tparam V T for a mutable iterator; const T for a read-only one.
+/// @tparam Reverse false to go from smallest to biggest; true to go from biggest (the max) to smallest.
+template <typename T, typename V, bool Reverse>
+class BinarySearchTreeIterator {
+  private:
+    /// @brief Nodes still to be visited; the top is the current node.
+    BinarySearchTreeStack<BinarySearchTreeNode<T>*> stack;
+
+    /// @brief Helper method to push a node and its whole left branch (right branch when reversed).
+    /// @param node The first node of the branch.
+    void pushBranch(BinarySearchTreeNode<T>* node);
+
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = V*;
+    using reference = V&;
+
+    /// @brief BinarySearchTreeIterator parameterized constructor.
+    /// @param root The root of the tree to traverse. nullptr is the end of the traversal.
+    explicit BinarySearchTreeIterator(BinarySearchTreeNode<T>* root = nullptr);
+    /// @brief Gets the data of the current node.
+    /// @return A reference to the data.
+    reference operator*() const;
+    /// @brief Accesses the members of the current node's data.
+    /// @return A pointer to the data.
+    pointer operator->() const;
+    /// @brief Moves to the next node in order.
+    /// @return This iterator, already moved.
+    BinarySearchTreeIterator& operator++();
+    /// @brief Moves to the next node in order.
+    /// @return A copy of this iterator from before moving.
+    BinarySearchTreeIterator operator++(int);
+    /// @brief Checks if two iterators point to the same node.
+    bool operator==(const BinarySearchTreeIterator& other) const;
+    /// @brief Checks if two iterators point to different nodes.
+    bool operator!=(const BinarySearchTreeIterator& other) const;
+    /// @brief Gets the node the iterator points to.
+    /// @return The current node. nullptr at the end of the traversal.
+    BinarySearchTreeNode<T>* getNode() const;
+};
+
+/// @brief BinarySearchTree class: implementation of a binary search tree. Contains a pointer to its root and a counter for the number of nodes.
+/// None of its algorithms recurse on the tree's height, so degenerate trees (e.g. many equal or sorted keys) don't overflow the call stack.
 /// @tparam T Template for use of generic data.
 template <typename T>
 class BinarySearchTree {
   private:
     BinarySearchTreeNode<T>* root;
+    int size;
 
     /// @brief Helper method to find the parent node of a particular child node.
     /// @param child The node whose parent is to be found.
-    /// @return A pointer to the parent node.
+    /// @return A pointer to the parent node. nullptr for the root.
     BinarySearchTreeNode<T>* findParent(const BinarySearchTreeNode<T>* child);
-    /// @brief Helper method to find the successor node when deleting another node.
-    /// @param predecessor The node whose successor must be found.
-    /// @return A pointer to the successor node.
-    BinarySearchTreeNode<T>* findSuccessor(const BinarySearchTreeNode<T>* predecessor);
-    /// @brief A helper method to recursively search for a node within the tree.
-    /// @param target The data of the node to be searched.
-    /// @param current The root of the current tree or sub-tree.
-    /// @return A pointer to the node that contains the target data.
-    BinarySearchTreeNode<T>* recursiveSearch(const T& target, BinarySearchTreeNode<T>* current) const;
-    /// @brief A helper method to recursively traverse the tree in order to find the position in which to insert a new node.
-    /// @param data The data that the new node must contain.
-    /// @param current The root of the current tree or sub-tree.
-    void recursiveInsert(const T& data, BinarySearchTreeNode<T>* current);
-    /// @brief A helper method to recursively traverse and print the values in the tree.
-    /// @param current The root of the current tree or sub-tree.
-    void printInOrder(const BinarySearchTreeNode<T>* current);
-    /// @brief A helper method to delete all the nodes in the tree in post order.
-    /// @param current The root of the current tree or sub-tree.
-    void deletePostOrder(BinarySearchTreeNode<T>* current);
-		/// @brief A helper method to find the size of the tree (number of nodes).
-		/// @param current The root of the current tree or sub-tree.
-		/// @return The size of the tree.
-		int getSizeRecursive(BinarySearchTreeNode<T>* current);
+    /// @brief A helper method to build a balanced sub-tree from the next elements of a sorted range, in order.
+    /// Recurses only O(log n) levels deep, since the result is balanced.
+    /// @param current The next element to use; advanced past every element used.
+    /// @param count How many elements the sub-tree holds.
+    /// @return The root of the new sub-tree.
+    template <typename InputIt>
+    static BinarySearchTreeNode<T>* buildBalanced(InputIt& current, std::ptrdiff_t count);
+    /// @brief A helper method to link an already built node into the tree, keeping BST order.
+    /// @param newNode The node to link. Must not have children.
+    /// @return A reference to the new node's data.
+    T& insertNode(BinarySearchTreeNode<T>* newNode);
+    /// @brief A helper method to delete all the nodes of a sub-tree in O(n) time and O(1) extra memory, by rotating left children up.
+    /// @param current The root of the sub-tree.
+    static void deleteSubtree(BinarySearchTreeNode<T>* current);
     
   public:
+    using iterator = BinarySearchTreeIterator<T, T, false>;
+    using const_iterator = BinarySearchTreeIterator<T, const T, false>;
+    using reverse_iterator = BinarySearchTreeIterator<T, T, true>;
+    using const_reverse_iterator = BinarySearchTreeIterator<T, const T, true>;
+
     /// @brief BinarySearchTree constructor.
     BinarySearchTree();
     /// @brief BinarySearchTree copy constructor.
@@ -99,6 +200,21 @@ class BinarySearchTree {
     /// @brief Inserts a new node. Maintains BST order (lesser values to the left, greater values to the right).
     /// @param data The data to be stored in the new node.
     void insert(const T& data);
+    /// @brief Inserts a new node, moving the data into it instead of copying it.
+    /// @param data The data to be moved into the new node.
+    void insert(T&& data);
+    /// @brief Inserts a new node whose data is built in place, without any temporary.
+    /// @param args The arguments forwarded to T's constructor.
+    /// @return A reference to the new data.
+    template <typename... Args>
+    T& emplace(Args&&... args);
+    /// @brief Replaces the tree's contents with a perfectly balanced tree built from a sorted range, in O(n).
+    /// Equal elements keep the order of the range in an in-order traversal, and may end up on both sides of each other;
+    /// search and remove handle that. Pass move iterators to move the elements instead of copying them.
+    /// @param first The first element of the range, which must be sorted from smallest to biggest.
+    /// @param last The end of the range.
+    template <typename InputIt>
+    void buildFromSorted(InputIt first, InputIt last);
 
     /// @brief Removes a node from the tree. Handles pointer management so the BST structure is preserved.
     /// @param data The data of the node to be removed.
@@ -119,9 +235,34 @@ class BinarySearchTree {
 		/// @brief Gets the biggest node in the tree.
 		/// @return A pointer to the biggest node in the tree.
 		BinarySearchTreeNode<T>* getMax();
-		/// @brief Gets the size of the tree (number of nodes).
+		/// @brief Gets the size of the tree (number of nodes), in O(1).
 		/// @return The size of the tree.
-		int getSize();
+		int getSize() const;
+
+		/// @brief Gets an iterator to the smallest node. Allows range-based for loops over the tree, in order.
+		/// @return An in-order iterator.
+		iterator begin();
+		/// @brief Gets the iterator past the biggest node.
+		/// @return The end iterator.
+		iterator end();
+		/// @brief Gets a read-only iterator to the smallest node.
+		/// @return A read-only in-order iterator.
+		const_iterator begin() const;
+		/// @brief Gets the read-only iterator past the biggest node.
+		/// @return The read-only end iterator.
+		const_iterator end() const;
+		/// @brief Gets a reverse iterator to the biggest node (the max). Visits the tree from biggest to smallest.
+		/// @return A reverse in-order iterator.
+		reverse_iterator rbegin();
+		/// @brief Gets the reverse iterator past the smallest node.
+		/// @return The reverse end iterator.
+		reverse_iterator rend();
+		/// @brief Gets a read-only reverse iterator to the biggest node.
+		/// @return A read-only reverse in-order iterator.
+		const_reverse_iterator rbegin() const;
+		/// @brief Gets the read-only reverse iterator past the smallest node.
+		/// @return The read-only reverse end iterator.
+		const_reverse_iterator rend() const;
 
 
     /// @brief Overload of comparison operator == to check if two BSTs are the same (their nodes' data and pointers are the same).
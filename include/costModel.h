@@ -0,0 +1,117 @@
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <instructionDictionary.h>
+
+/// @brief Distribucion del tiempo de servicio de un dispositivo de E/S.
+enum class ServiceDistribution {
+  FIXED,        // siempre la latencia
+  EXPONENTIAL,  // exponencial con promedio igual a la latencia
+  UNIFORM       // uniforme entre 0 y el doble de la latencia
+};
+
+/// @brief Descripcion de un dispositivo de E/S declarado en el encabezado del archivo de procesos.
+struct DeviceSpec {
+  std::string name;
+  double latency;                     // tiempo de servicio promedio de una operacion, en segundos
+  int parallelism;                    // cantidad de operaciones que atiende a la vez
+  ServiceDistribution distribution;
+};
+
+/// @brief Tabla de costos de las instrucciones, indexada por su ID en el InstructionDictionary.
+/// Se declara en el encabezado del archivo de procesos (antes del primer "proceso") y se resuelve una sola vez al cargar:
+/// cada instruccion de un Program guarda su costo, asi que ejecutar un proceso no vuelve a consultar esta tabla.
+/// Sintaxis del encabezado:
+///   costo <instruccion> <ciclos>       costo de una instruccion en particular (p. ej. "costo e/s 2", "costo instruccion 3 4")
+///   costo predeterminado <ciclos>      costo de las instrucciones normales sin costo propio
+///   latencia <segundos>                latencia del dispositivo predeterminado (el de las lineas "e/s" sin dispositivo)
+///   dispositivo <nombre> <segundos> [paralelismo] [fija|exponencial|uniforme]
+///                                      dispositivo de E/S para las lineas "e/s <nombre>"; por defecto paralelismo 1 y tiempo fijo
+class CostModel {
+  private:
+    double* costs;      // costs[id]: costo de la instruccion id; negativo si no tiene costo propio
+    int capacity;
+    double cpuCost;     // costo de las instrucciones normales sin costo propio
+    DeviceSpec* devices; // devices[0] es el dispositivo predeterminado
+    int deviceCount;
+    int deviceCapacity;
+
+    /// @brief Agranda la tabla para que quepa un ID.
+    /// @param id El ID que debe caber.
+    void reserve(int id);
+
+  public:
+    /// @brief Costo predeterminado de una instruccion normal, en ciclos (1 ciclo = 1 segundo).
+    static constexpr double DEFAULT_CPU_COST = 1;
+    /// @brief Costo predeterminado de cada mitad de una operacion de E/S, en ciclos.
+    static constexpr double DEFAULT_IO_COST = 1.5;
+    /// @brief Latencia predeterminada de una operacion de E/S, en segundos.
+    static constexpr double DEFAULT_IO_LATENCY = 15;
+    /// @brief Indice del dispositivo predeterminado.
+    static const int DEFAULT_DEVICE = 0;
+
+    /// @brief Constructor de CostModel. Empieza con los costos predeterminados.
+    CostModel();
+    /// @brief Constructor de copia de CostModel.
+    /// @param other El otro modelo a copiar en este
+    CostModel(const CostModel& other);
+    /// @brief Constructor de asignacion por copia
+    /// @param other El otro modelo a copiar en este
+    /// @return Este modelo con los datos copiados
+    CostModel& operator=(const CostModel& other);
+    /// @brief Destructor de CostModel.
+    ~CostModel();
+
+    /// @brief Costo predeterminado de una instruccion, sin tabla: DEFAULT_IO_COST para "e/s" y DEFAULT_CPU_COST para las demas.
+    /// @param instructionId El ID de la instruccion.
+    /// @return El costo en ciclos.
+    static double getDefaultCost(int instructionId);
+
+    /// @brief Getter del costo de una instruccion.
+    /// @param instructionId El ID de la instruccion.
+    /// @return El costo en ciclos.
+    double getCost(int instructionId) const;
+    /// @brief Setter del costo de una instruccion.
+    /// @param instructionId El ID de la instruccion.
+    /// @param cost El nuevo costo en ciclos.
+    void setCost(int instructionId, double cost);
+    /// @brief Getter del costo de las instrucciones normales sin costo propio.
+    /// @return El costo en ciclos.
+    double getCPUCost() const;
+    /// @brief Setter del costo de las instrucciones normales sin costo propio.
+    /// @param cost El nuevo costo en ciclos.
+    void setCPUCost(double cost);
+    /// @brief Getter de la latencia del dispositivo predeterminado.
+    /// @return La latencia en segundos.
+    double getIOLatency() const;
+    /// @brief Setter de la latencia del dispositivo predeterminado.
+    /// @param latency La nueva latencia en segundos.
+    void setIOLatency(double latency);
+
+    /// @brief Getter de la cantidad de dispositivos, incluido el predeterminado.
+    /// @return La cantidad de dispositivos.
+    int getDeviceCount() const;
+    /// @brief Getter de un dispositivo.
+    /// @param index El indice del dispositivo, entre 0 y getDeviceCount() - 1.
+    /// @return La descripcion del dispositivo.
+    const DeviceSpec& getDevice(int index) const;
+    /// @brief Busca un dispositivo por su nombre.
+    /// @param name El nombre del dispositivo.
+    /// @return Su indice; -1 si no existe.
+    int findDevice(const std::string& name) const;
+    /// @brief Declara un dispositivo, o reemplaza el que tenga el mismo nombre.
+    /// @param device La descripcion del dispositivo.
+    /// @return El indice del dispositivo.
+    int addDevice(const DeviceSpec& device);
+
+    /// @brief Revisa si una linea es una directiva del encabezado ("costo ...", "latencia ..." o "dispositivo ...").
+    /// @param line La linea del archivo.
+    /// @return true si sí; false si no.
+    static bool isDirective(const std::string& line);
+    /// @brief Interpreta una directiva del encabezado y la aplica a la tabla.
+    /// @param line La linea del archivo.
+    /// @param errors Donde se escribe el error, si la directiva tiene alguno
+    /// @return true si logro interpretarla; false si tiene algun error
+    bool parseDirective(const std::string& line, std::ostream& errors = std::cerr);
+};
@@ -3,9 +3,17 @@
 #include <fstream>
 #include <iostream>
 #include <sstream>
+#include <costModel.h>
 #include <singlyLinkedList.hxx>
 #include <process.h>
 
+/// @brief Un problema encontrado al leer el archivo de procesos.
+struct ParseDiagnostic {
+  long long line;       // numero de linea en el archivo, desde 1
+  bool error;           // true si se descarto un proceso; false si solo es una advertencia
+  std::string message;
+};
+
 /// @brief Clase que lee e interpreta procesos de un archivo de texto
 class FileParser {
   private:
@@ -13,8 +21,69 @@ class FileParser {
     std::string filename;
     /// @brief La lista de los procesos interpretada
     SinglyLinkedList<Process>* processes;
+    /// @brief Los costos declarados en el encabezado del archivo
+    CostModel* costModel;
+    /// @brief Los primeros MAX_DIAGNOSTICS diagnosticos, en el orden del archivo
+    SinglyLinkedList<ParseDiagnostic>* diagnostics;
+    long long lineCount;
+    int errorCount;
+    int warningCount;
+    int discardedCount;
+
+    /// @brief Estado de la lectura de un archivo o de un pedazo: cada hilo de parseFileParallel tiene el suyo.
+    /// Las lineas se cuentan desde el comienzo de lo que lee el estado; collect las corrige.
+    struct ParseState {
+      Process* nuevoProceso = nullptr;  // el proceso abierto, o nullptr si no hay
+      bool descartando = false;         // se ignoran las lineas hasta el "fin proceso" de un encabezado invalido
+      long long linea = 0;              // lineas leidas
+      long long lineaProceso = 0;       // linea del encabezado del proceso abierto
+      SinglyLinkedList<ParseDiagnostic> diagnosticos;
+      int errores = 0;
+      int advertencias = 0;
+      int descartados = 0;
+
+      /// @brief Registra un diagnostico. Solo guarda los primeros MAX_DIAGNOSTICS, pero los cuenta todos.
+      /// @param linea La linea del problema
+      /// @param error true si es un error; false si es una advertencia
+      /// @param mensaje El mensaje
+      void report(long long linea, bool error, const std::string& mensaje);
+    };
+
+    /// @brief Interpreta una linea del archivo. Las lineas invalidas se reportan en el estado en lugar de lanzar excepciones:
+    /// un encabezado invalido descarta su proceso entero, y un proceso sin "fin proceso" se descarta al llegar el siguiente.
+    /// @param linea La linea
+    /// @param estado El estado de la lectura; se actualiza al abrir o cerrar un proceso
+    /// @param destino La lista donde se insertan (al frente) los procesos que se cierran
+    /// @param aplicarDirectivas true para aplicar las directivas de costos fuera de los procesos; false para solo reportarlas
+    /// @return false si la linea es una directiva de costos que no se aplico; true si no
+    bool parseLine(const std::string& linea, ParseState& estado, SinglyLinkedList<Process>& destino, bool aplicarDirectivas);
+    /// @brief Interpreta las lineas de un stream hasta el final, con parseLine.
+    /// @param archivo El stream
+    /// @param estado El estado de la lectura
+    void parseLines(std::istream& archivo, ParseState& estado);
+    /// @brief Termina una lectura: descarta (y reporta) el proceso que quedo abierto.
+    /// @param estado El estado de la lectura
+    static void finish(ParseState& estado);
+    /// @brief Suma los diagnosticos y contadores de una lectura terminada a los del archivo.
+    /// @param estado El estado de la lectura; queda sin diagnosticos
+    /// @param desplazamiento Las lineas del archivo antes de la primera que leyo el estado
+    void collect(ParseState& estado, long long desplazamiento);
+    /// @brief Interpreta en un hilo un pedazo del archivo, para parseFileParallel: desde el primer encabezado de proceso que
+    /// empieza en o despues de un byte hasta el primero que empieza en o despues de otro.
+    /// @param filename El nombre del archivo
+    /// @param inicio El byte donde empieza el pedazo
+    /// @param fin El byte donde termina el pedazo
+    /// @param destino La lista del pedazo, con sus procesos en orden inverso
+    /// @param estado El estado del pedazo, que cuenta las lineas desde su primer encabezado
+    /// @return false si el pedazo tiene una directiva de costos entre procesos; true si no
+    bool parseShard(const std::string& filename, long long inicio, long long fin, SinglyLinkedList<Process>& destino, ParseState& estado);
 
   public:
+    /// @brief Tamaño minimo de cada pedazo de parseFileParallel cuando escoge la cantidad de hilos
+    static const long long MIN_SHARD_SIZE = 1 << 20;
+    /// @brief Cantidad maxima de diagnosticos que se guardan; los demas solo se cuentan
+    static const int MAX_DIAGNOSTICS = 1000;
+
     /// @brief Constructor predeterminado
     FileParser();
     /// @brief Constructor parametrizado
@@ -24,10 +93,42 @@ class FileParser {
     ~FileParser();
 
     /// @brief Lee el archivo indicado y almacena sus procesos. Guarda el nombre del archivo especificado como su nuevo nombre.
+    /// Los problemas del archivo no detienen la lectura: quedan como diagnosticos con su numero de linea.
     /// @param filename El nombre del archivo por leer.
-    /// @return true si logro hacer todo bien; false si tuvo algun error
+    /// @return true si logro abrir el archivo; false si no
     bool parseFile(const std::string filename);
+    /// @brief Como parseFile, pero interpreta los procesos en varios hilos. El encabezado de costos se lee primero; el resto del archivo
+    /// se divide en pedazos de igual tamaño que se sincronizan en el siguiente encabezado "proceso", y cada hilo llena su propia lista.
+    /// Las listas se unen en el orden del archivo, asi que el resultado es el mismo de parseFile.
+    /// Si hay directivas de costos entre procesos (que cambian el costo de los procesos siguientes), el resto se lee en un solo hilo.
+    /// @param filename El nombre del archivo por leer.
+    /// @param threadCount La cantidad de hilos; 0 para usar los nucleos disponibles, con pedazos de al menos MIN_SHARD_SIZE bytes
+    /// @return true si logro abrir el archivo; false si no
+    bool parseFileParallel(const std::string filename, int threadCount = 0);
     /// @brief Getter de la lista de procesos
     /// @return La lista de procesos
     SinglyLinkedList<Process>* getProcesses();
+    /// @brief Getter del modelo de costos. Los costos de las instrucciones ya quedan resueltos en los procesos;
+    /// el planificador solo necesita la latencia de E/S.
+    /// @return El modelo de costos
+    const CostModel& getCostModel() const;
+    /// @brief Getter de los diagnosticos guardados (los primeros MAX_DIAGNOSTICS), en el orden del archivo
+    /// @return La lista de diagnosticos
+    const SinglyLinkedList<ParseDiagnostic>& getDiagnostics() const;
+    /// @brief Getter de la cantidad de errores, incluidos los que no se guardaron
+    /// @return La cantidad de errores
+    int getErrorCount() const;
+    /// @brief Getter de la cantidad de advertencias, incluidas las que no se guardaron
+    /// @return La cantidad de advertencias
+    int getWarningCount() const;
+    /// @brief Getter de la cantidad de procesos descartados
+    /// @return La cantidad de procesos
+    int getDiscardedCount() const;
+    /// @brief Getter de la cantidad de lineas leidas
+    /// @return La cantidad de lineas
+    long long getLineCount() const;
+    /// @brief Imprime un resumen de la lectura y los primeros diagnosticos.
+    /// @param os El stream de salida
+    /// @param limit La cantidad maxima de diagnosticos por imprimir
+    void printDiagnostics(std::ostream& os, int limit = 20) const;
 };
\ No newline at end of file
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <string>
+
+/// @brief Diccionario global de instrucciones internadas: cada texto distinto (p. ej. "instruccion 1", "e/s") se guarda una sola vez
+/// y los procesos solo guardan su ID, un entero pequeño. Los IDs son estables durante toda la ejecucion.
+/// Internar toma un mutex; leer el texto de un ID ya obtenido no toma ningun lock, porque los textos viven en bloques que nunca se mueven.
+/// El directorio de bloques crece al llenarse, asi que no hay un limite de textos distintos (fuera del rango de int).
+class InstructionDictionary {
+  public:
+    /// @brief ID de "e/s", fijo para poder reconocer las instrucciones de E/S sin comparar texto.
+    static const int IO = 0;
+    /// @brief Cantidad de textos por bloque de almacenamiento.
+    static const int CHUNK_SIZE = 1024;
+
+    /// @brief Obtiene el ID de un texto, agregandolo al diccionario si todavia no existe. Seguro entre hilos.
+    /// @param text El texto de la instruccion.
+    /// @return Su ID.
+    static int intern(const std::string& text);
+    /// @brief Obtiene el texto de un ID. No toma locks.
+    /// @param id Un ID devuelto por intern.
+    /// @return El texto de la instruccion.
+    static const std::string& getText(int id);
+    /// @brief Cantidad de textos distintos internados.
+    /// @return La cantidad de IDs validos (de 0 a getSize() - 1).
+    static int getSize();
+};
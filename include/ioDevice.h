@@ -0,0 +1,86 @@
+#pragma once
+
+#include <iostream>
+#include <random>
+#include <costModel.h>
+#include <latencyHistogram.h>
+#include <process.h>
+#include <singlyLinkedList.hxx>
+
+/// @brief Dispositivo de E/S del planificador, con su propia cola.
+/// Atiende hasta "parallelism" operaciones a la vez, en orden de llegada; cada una tarda un tiempo sacado de su distribucion de servicio.
+/// Los tiempos son segundos del reloj del planificador, y cada proceso guarda en sus ProcessTimes cuando empezo y cuando termina su operacion.
+class IODevice {
+  private:
+    DeviceSpec spec;
+    /// @brief Procesos que esperan un canal libre
+    SinglyLinkedList<Process>* waiting;
+    /// @brief Procesos que el dispositivo esta atendiendo (a lo sumo spec.parallelism)
+    SinglyLinkedList<Process>* serving;
+    /// @brief Tiempo que cada operacion espero en la cola antes de ser atendida
+    LatencyHistogram* queueingHistogram;
+    /// @brief Suma de los tiempos de servicio ya cumplidos, en segundos
+    double busyTime;
+    /// @brief Cantidad de operaciones atendidas por completo
+    int completed;
+    std::mt19937 generator;
+
+    /// @brief Saca un tiempo de servicio de la distribucion del dispositivo.
+    /// @return El tiempo de servicio en segundos
+    double sampleServiceTime();
+    /// @brief Empieza a atender procesos en espera mientras haya canales libres.
+    /// @param now El tiempo actual
+    void startWaiting(double now);
+
+  public:
+    /// @brief Constructor parametrizado
+    /// @param newSpec La descripcion del dispositivo
+    /// @param seed La semilla de la corrida; cada dispositivo la combina con su nombre
+    IODevice(const DeviceSpec& newSpec, unsigned int seed = 0);
+    IODevice(const IODevice& other) = delete;
+    IODevice& operator=(const IODevice& other) = delete;
+    /// @brief Destructor
+    ~IODevice();
+
+    /// @brief Reinicia el generador de tiempos de servicio, para que la misma semilla de siempre la misma secuencia.
+    /// @param seed La semilla de la corrida
+    void reseed(unsigned int seed);
+    /// @brief Pone un proceso en la cola del dispositivo; si hay un canal libre, lo empieza a atender de una vez.
+    /// @param process El proceso bloqueado
+    /// @param now El tiempo actual
+    void enqueue(const Process& process, double now);
+    /// @brief Busca un proceso cuya operacion ya termino, despues de empezar a atender a los que quepan.
+    /// El proceso sigue en el dispositivo hasta que se quite con remove.
+    /// @param now El tiempo actual
+    /// @return El proceso; nullptr si ninguno ha terminado
+    Process* nextCompleted(double now);
+    /// @brief Quita un proceso del dispositivo, termine o no su operacion.
+    /// @param process El proceso que se quita
+    /// @param now El tiempo actual
+    /// @return true si el proceso estaba en el dispositivo; false si no
+    bool remove(const Process& process, double now);
+    /// @brief Obtiene el proceso que va a terminar primero: el que se atiende con el menor tiempo de fin, o si no hay, el primero en espera.
+    /// @return El proceso; nullptr si el dispositivo esta vacio
+    Process* peek();
+
+    /// @brief Getter de la descripcion del dispositivo
+    /// @return La descripcion
+    const DeviceSpec& getSpec() const;
+    /// @brief Cantidad de procesos en el dispositivo, en espera o siendo atendidos
+    /// @return La cantidad de procesos
+    int getSize() const;
+    /// @brief Getter de la cantidad de operaciones atendidas por completo
+    /// @return La cantidad de operaciones
+    int getCompleted() const;
+    /// @brief Calcula la fraccion del tiempo que los canales del dispositivo estuvieron ocupados
+    /// @param elapsed El tiempo total de la corrida, en segundos
+    /// @return La utilizacion, entre 0 y 1
+    double getUtilization(double elapsed) const;
+    /// @brief Getter del histograma de esperas en la cola (microsegundos)
+    /// @return El histograma
+    const LatencyHistogram& getQueueingHistogram() const;
+    /// @brief Imprime las operaciones, la utilizacion y las esperas en cola del dispositivo
+    /// @param os El stream de salida
+    /// @param elapsed El tiempo total de la corrida, en segundos
+    void printReport(std::ostream& os, double elapsed) const;
+};
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <iostream>
+#include <string>
+
+/// @brief Histograma de latencias al estilo HDR: cubetas lineales dentro de cada potencia de 2, con error relativo menor a 1/128.
+/// Registrar es O(1) y no reserva memoria (todas las cubetas son un arreglo fijo). Dos histogramas se pueden sumar con merge,
+/// por ejemplo los de corridas paralelas. Los valores son enteros no negativos (en el planificador, microsegundos).
+class LatencyHistogram {
+  public:
+    /// @brief Bits de la parte lineal: cada potencia de 2 se divide en 2^(SUB_BUCKET_BITS - 1) cubetas.
+    static const int SUB_BUCKET_BITS = 8;
+    static const int SUB_BUCKET_COUNT = 1 << SUB_BUCKET_BITS;
+    static const int SUB_BUCKET_HALF = SUB_BUCKET_COUNT / 2;
+    /// @brief Mayor exponente representable: valores de hasta 2^48 - 1.
+    static const int MAX_SHIFT = 40;
+    static const int BUCKET_COUNT = SUB_BUCKET_COUNT + MAX_SHIFT * SUB_BUCKET_HALF;
+
+  private:
+    unsigned long long counts[BUCKET_COUNT];
+    unsigned long long totalCount;
+    unsigned long long minValue;
+    unsigned long long maxValue;
+    double sum;
+
+    /// @brief Calcula la cubeta de un valor.
+    /// @param value El valor.
+    /// @return El indice de su cubeta.
+    static int bucketIndex(unsigned long long value);
+    /// @brief Calcula el menor valor que cae en una cubeta.
+    /// @param index El indice de la cubeta.
+    /// @return El menor valor de la cubeta.
+    static unsigned long long bucketLowest(int index);
+    /// @brief Calcula el mayor valor que cae en una cubeta.
+    /// @param index El indice de la cubeta.
+    /// @return El mayor valor de la cubeta.
+    static unsigned long long bucketHighest(int index);
+
+  public:
+    /// @brief Constructor predeterminado. El histograma empieza vacio.
+    LatencyHistogram();
+
+    /// @brief Registra un valor en O(1). Los valores fuera de rango se guardan en la ultima cubeta.
+    /// @param value El valor.
+    void record(unsigned long long value);
+    /// @brief Suma los conteos de otro histograma a este.
+    /// @param other El otro histograma.
+    void merge(const LatencyHistogram& other);
+    /// @brief Vacia el histograma.
+    void reset();
+
+    /// @brief Getter de la cantidad de valores registrados.
+    /// @return La cantidad de valores.
+    unsigned long long getCount() const;
+    /// @brief Getter del menor valor registrado.
+    /// @return El menor valor; 0 si esta vacio.
+    unsigned long long getMin() const;
+    /// @brief Getter del mayor valor registrado.
+    /// @return El mayor valor; 0 si esta vacio.
+    unsigned long long getMax() const;
+    /// @brief Calcula el promedio exacto de los valores registrados.
+    /// @return El promedio; 0 si esta vacio.
+    double getMean() const;
+    /// @brief Calcula un percentil. Devuelve el mayor valor equivalente de la cubeta, acotado por el maximo registrado.
+    /// @param percentile El percentil, entre 0 y 100.
+    /// @return El valor en ese percentil; 0 si esta vacio.
+    unsigned long long getPercentile(double percentile) const;
+
+    /// @brief Imprime la cantidad, el promedio y los percentiles p50/p90/p99/p99.9 en una linea.
+    /// @param os El stream de salida.
+    /// @param label El nombre de la metrica.
+    /// @param scale Divisor para mostrar los valores (por ejemplo 1e6 para pasar de microsegundos a segundos).
+    /// @param unit La unidad que se muestra.
+    void print(std::ostream& os, const std::string& label, double scale, const std::string& unit) const;
+};
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <atomic>
+#include <utility>
+
+/// @brief MPSCQueueNode class for use in a multi-producer single-consumer queue. Contains some data and an atomic pointer to the next node.
+/// @tparam T Template for use of generic data.
+template <typename T>
+class MPSCQueueNode {
+  private:
+    T data;
+    std::atomic<MPSCQueueNode*> next;
+
+    template <typename U>
+    friend class MPSCQueue;
+
+  public:
+    /// @brief MPSCQueueNode constructor.
+    MPSCQueueNode();
+    /// @brief MPSCQueueNode parameterized constructor.
+    /// @param newData The data to be copied into the node.
+    MPSCQueueNode(const T& newData);
+    /// @brief MPSCQueueNode parameterized constructor.
+    /// @param newData The data to be moved into the node.
+    MPSCQueueNode(T&& newData);
+};
+
+/// @brief MPSCQueue class: lock-free, unbounded multi-producer single-consumer FIFO queue (Vyukov's intrusive design).
+/// Any number of threads may push concurrently without taking a lock; only one thread may pop.
+/// A pop can transiently report an empty queue while a producer is halfway through a push; that element shows up on a later pop.
+/// @tparam T Template for use of generic data. Must be default constructible (for the stub node).
+template <typename T>
+class MPSCQueue {
+  private:
+    /// @brief Most recently pushed node. Producers swap themselves in here.
+    std::atomic<MPSCQueueNode<T>*> head;
+    /// @brief Oldest node, already consumed (stub). Only touched by the consumer.
+    MPSCQueueNode<T>* tail;
+
+    /// @brief Helper method to link an already built node at the head of the queue.
+    /// @param node The node to link.
+    void pushNode(MPSCQueueNode<T>* node);
+
+  public:
+    /// @brief MPSCQueue constructor.
+    MPSCQueue();
+    /// @brief MPSCQueue destructor. Must not race with producers.
+    ~MPSCQueue();
+    MPSCQueue(const MPSCQueue& other) = delete;
+    MPSCQueue& operator=(const MPSCQueue& other) = delete;
+
+    /// @brief Pushes a copy of some data. Safe to call from any thread.
+    /// @param data The data to push.
+    void push(const T& data);
+    /// @brief Pushes some data by moving it. Safe to call from any thread.
+    /// @param data The data to push.
+    void push(T&& data);
+    /// @brief Pops the oldest element. Must only be called from the consumer thread.
+    /// @param out Where the popped data is moved to.
+    /// @return True if an element was popped; false if the queue looked empty.
+    bool tryPop(T& out);
+    /// @brief Checks if the queue looks empty. Must only be called from the consumer thread.
+    /// @return True if there is nothing ready to pop; false otherwise.
+    bool isEmpty() const;
+};
+
+#include <mpscQueue.tpp>
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <singlyLinkedList.hxx>
+#include <process.h>
+
+/// @brief Registro de un proceso hijo real asociado a un Process.
+/// Contiene: 1. el nombre y el identificador del proceso, 2. su pid, 3. si ya termino y con que estado, y 4. el tiempo de CPU y de pared que consumio.
+struct NativeJob {
+  std::string name;
+  unsigned long long processId;
+  int pid;
+  bool finished;
+  int exitStatus;
+  double userSeconds;
+  double systemSeconds;
+  double wallSeconds;
+  int slices;
+};
+
+/// @brief Backend opcional que ejecuta el comando de cada proceso como un proceso hijo real (fork/exec) en lugar de simular sus instrucciones.
+/// La politica del planificador se impone con SIGSTOP/SIGCONT sobre el grupo del hijo, opcionalmente fijando todos los hijos a un mismo CPU
+/// con sched_setaffinity para que no corran en paralelo. El tiempo de CPU se obtiene con wait4 al terminar cada hijo.
+/// Solo esta disponible en Linux/UNIX.
+class NativeBackend {
+  private:
+    /// @brief Los hijos lanzados hasta ahora, en orden de lanzamiento
+    SinglyLinkedList<NativeJob>* jobs;
+    /// @brief Registro de cada hijo indexado por el identificador de su proceso; crece al lanzar un proceso con un identificador mayor
+    NativeJob** jobsById;
+    unsigned long long jobsByIdSize;
+    /// @brief CPU al que se fijan los hijos; -1 si no se fijan
+    int pinnedCpu;
+
+    /// @brief Busca el registro del hijo de un proceso, en O(1).
+    /// @param processId El identificador del proceso.
+    /// @return El registro, o nullptr si el proceso aun no tiene hijo.
+    NativeJob* findJob(unsigned long long processId);
+    /// @brief Lanza el hijo de un proceso y lo deja detenido antes de ejecutar el comando.
+    /// @param process El proceso cuyo comando se lanza.
+    /// @return El registro del nuevo hijo.
+    NativeJob* launch(const Process& process);
+
+  public:
+    /// @brief Constructor parametrizado
+    /// @param newPinnedCpu CPU al que se fijan los hijos; -1 para no fijarlos
+    NativeBackend(int newPinnedCpu = -1);
+    /// @brief Destructor. Mata a los hijos que no hayan terminado.
+    ~NativeBackend();
+
+    /// @brief Revisa si el backend nativo se puede usar en esta plataforma.
+    /// @return true si sí; false si no.
+    static bool isSupported();
+    /// @brief Deja correr el hijo de un proceso durante a lo sumo cierto tiempo de pared, lanzandolo si es la primera vez.
+    /// @param process El proceso que se ejecuta; debe tener un comando y haber sido admitido (su identificador distingue a su hijo).
+    /// @param seconds El tiempo maximo, en segundos, que el hijo puede correr antes de detenerse.
+    /// @return true si el hijo termino; false si se detuvo por agotar su tiempo.
+    bool runSlice(const Process& process, double seconds);
+    /// @brief Getter de la lista de hijos lanzados.
+    /// @return La lista de hijos.
+    SinglyLinkedList<NativeJob>* getJobs();
+    /// @brief Imprime el tiempo de CPU (usuario y sistema), de pared y el estado de salida de cada hijo.
+    /// @param os El stream de salida.
+    void printReport(std::ostream& os);
+};
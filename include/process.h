@@ -2,12 +2,9 @@
 
 #include <iostream>
 #include <string>
-#ifdef _WINDOWS32
-  #include <windows.h>
-#else
-  #include <unistd.h>
-#endif
 #include <singlyLinkedList.hxx>
+#include <program.h>
+#include <simulationClock.h>
 
 /// @brief Enum para cambiar facilmente entre los distintos estados del proceso
 enum class ProcessState {
@@ -24,33 +21,65 @@ enum class ProcessState {
 /// @return El stream de salida.
 std::ostream& operator<<(std::ostream& os, const ProcessState& state);
 
+/// @brief Marcas de tiempo de un proceso, en segundos del reloj del planificador, para medir sus latencias.
+struct ProcessTimes {
+  double arrival;       // llegada al planificador
+  double readySince;    // ultima vez que entro a la cola READY
+  double blockedSince;  // ultima vez que entro a la cola BLOCKED
+  double waiting;       // tiempo total acumulado en la cola READY
+  bool dispatched;      // si ya se ejecuto alguna vez (para el tiempo de respuesta)
+  double ioStart;       // cuando su dispositivo empezo a atender la operacion de E/S en curso
+  double ioDone;        // cuando su dispositivo termina de atenderla
+  int timelineTrack;    // su linea en la Timeline del planificador; -1 si no tiene
+  double absoluteDeadline; // llegada + plazo, en segundos del reloj del planificador; negativo si no tiene plazo
+  int lastCpu;          // CPU en que corrio por ultima vez; -1 si todavia no corre
+};
+
 /// @brief Clase que representa un proceso.
-/// Contiene: 1. nombre del proceso, 2. prioridad del proceso, 3. las instrucciones del proceso, 4. el estado del proceso,
+/// Contiene: 1. nombre del proceso, 2. prioridad del proceso, 3. las instrucciones del proceso (IDs del InstructionDictionary), 4. el estado del proceso,
 /// 5. el indice de la instruccion en ejecucion, 6. el quantum que le queda al proceso, y 7. una bandera que indica si aun debe terminar una instruccion de E/S
 class Process {
   private:
     std::string name;
     int priority;                     
-    SinglyLinkedList<std::string>* instructions;
+    Program* program;                 // instrucciones y su perfil, compartidos entre copias; nunca es nullptr
     ProcessState state;
     int instructionIndex;
-    float remainingQuantum;          
+    double remainingQuantum;
     bool IOPending;
+    std::string command;              // comando real opcional para el backend nativo
+    double deadline;                  // plazo relativo a la llegada, en segundos; 0 si no tiene
+    double period;                    // periodo, en segundos; 0 si no es periodico
+    std::string group;                // grupo de procesos que se planifican juntos; vacio si no tiene
+    int affinity;                     // CPU preferido; -1 si no tiene
+    unsigned long long id;            // identificador que le da el planificador al admitirlo; 0 si no se ha admitido
+    ProcessTimes times;
     
   public:
+  /// @brief Prioridad minima que puede alcanzar un proceso al recalcular su prioridad.
+  static constexpr int MIN_PRIORITY = Program::MIN_PRIORITY;
+  /// @brief Prioridad maxima que puede alcanzar un proceso al recalcular su prioridad.
+  static constexpr int MAX_PRIORITY = Program::MAX_PRIORITY;
   /// @brief Constructor de Process.
   Process();
   /// @brief Constructor parametrizado de Process.
   /// @param newName El nombre del nuevo proceso.
   /// @param newPriority La prioridad del nuevo proceso.
   Process(const std::string newName, int newPriority);
-	/// @brief Constructor de movimiento de Process.
-	/// @param other El otro proceso a mover en este
+	/// @brief Constructor de copia de Process. Comparte el programa del otro proceso en lugar de copiar sus instrucciones (O(1)).
+	/// @param other El otro proceso a copiar en este
 	Process(const Process& other);
-	/// @brief Constructor de asignacion movimiento 
+	/// @brief Constructor de asignacion por copia
+	/// @param other El otro proceso a copiar en este
+	/// @return Este proceso con los datos copiados
+	Process& operator=(const Process& other);
+	/// @brief Constructor de movimiento de Process. Toma el programa del otro proceso; el otro proceso queda sin instrucciones.
+	/// @param other El otro proceso a mover en este
+	Process(Process&& other) noexcept;
+	/// @brief Constructor de asignacion por movimiento. Intercambia el programa con el otro proceso.
 	/// @param other El otro proceso a mover en este
 	/// @return Este proceso con los datos movidos
-	Process& operator=(const Process& other);
+	Process& operator=(Process&& other) noexcept;
   /// @brief Destructor de Process.
   ~Process();
   
@@ -77,27 +106,131 @@ class Process {
 	int getInstructionIndex() const;
   /// @brief Getter del quantum restante.
   /// @return El quantum restante.
-  float getQuantum() const;
+  double getQuantum() const;
   /// @brief Setter para el quantum del proceso.
   /// @param quantum El nuevo quantum del proceso.
-  void setQuantum(float newQuantum);
-	/// @brief 
-	/// @return 
-	SinglyLinkedList<std::string>* getInstructions() const;
+  void setQuantum(double newQuantum);
+  /// @brief Revisa si una instruccion cabe en el quantum restante. Es la unica regla para decidirlo: la usan la ejecucion paso a paso
+  /// y, por Program::findBurstEnd, la ejecucion por rafagas, asi que la traza por instruccion no cambia la planificacion.
+  /// @param cost El costo de la instruccion en ciclos.
+  /// @return true si cabe (con Program::COST_TOLERANCE de holgura); false si no.
+  bool fitsInQuantum(double cost) const;
+  /// @brief Revisa si el quantum ya se agoto (no queda mas que la holgura de Program::COST_TOLERANCE).
+  /// @return true si se agoto; false si no.
+  bool isQuantumExhausted() const;
+	/// @brief Getter de la cantidad de instrucciones del proceso.
+	/// @return La cantidad de instrucciones.
+	int getInstructionCount() const;
+	/// @brief Getter del ID de una instruccion.
+	/// @param index La posicion de la instruccion (indexada desde 1).
+	/// @return El ID en el InstructionDictionary; -1 si no existe esa posicion.
+	int getInstructionId(int index) const;
+	/// @brief Getter del texto de una instruccion.
+	/// @param index La posicion de la instruccion (indexada desde 1).
+	/// @return Un puntero al texto; nullptr si no existe esa posicion.
+	const std::string* getInstruction(int index) const;
+	/// @brief Getter de los IDs de todas las instrucciones.
+	/// @return El arreglo de IDs (getInstructionCount() elementos); nullptr si no hay instrucciones.
+	const int* getInstructionIds() const;
+	/// @brief Getter del programa del proceso. Dos copias de un proceso comparten el mismo programa hasta que una lo modifica.
+	/// @return El programa.
+	const Program* getProgram() const;
+	/// @brief Getter del costo de una instruccion.
+	/// @param index La posicion de la instruccion (indexada desde 1).
+	/// @return El costo en ciclos; 0 si no existe esa posicion.
+	double getInstructionCost(int index) const;
+	/// @brief Getter del dispositivo de la operacion de E/S en curso (la que empezo startIO).
+	/// @return El indice del dispositivo en el CostModel.
+	int getIODevice() const;
+	/// @brief Getter de las marcas de tiempo del proceso.
+	/// @return Las marcas de tiempo, modificables por el planificador.
+	ProcessTimes& getTimes();
+	/// @brief Getter constante de las marcas de tiempo del proceso.
+	/// @return Las marcas de tiempo.
+	const ProcessTimes& getTimes() const;
+	/// @brief Getter del comando real del proceso.
+	/// @return El comando; vacio si el proceso solo se simula.
+	const std::string& getCommand() const;
+	/// @brief Setter del comando real que el backend nativo ejecuta en lugar de simular las instrucciones.
+	/// @param newCommand El nuevo comando.
+	void setCommand(const std::string& newCommand);
+	/// @brief Revisa si el proceso tiene un comando real.
+	/// @return true si sí; false si no.
+	bool hasCommand() const;
+	/// @brief Getter del plazo, relativo a la llegada del proceso. Si no tiene plazo pero tiene periodo, el plazo es el periodo.
+	/// @return El plazo en segundos; 0 si no tiene.
+	double getDeadline() const;
+	/// @brief Setter del plazo
+	/// @param newDeadline El nuevo plazo en segundos, relativo a la llegada; 0 para ninguno.
+	void setDeadline(double newDeadline);
+	/// @brief Getter del periodo
+	/// @return El periodo en segundos; 0 si no es periodico.
+	double getPeriod() const;
+	/// @brief Setter del periodo
+	/// @param newPeriod El nuevo periodo en segundos; 0 para ninguno.
+	void setPeriod(double newPeriod);
+	/// @brief Getter del grupo del proceso; con varios CPUs, los procesos de un grupo se despachan en la misma ronda.
+	/// @return El nombre del grupo; vacio si no tiene.
+	const std::string& getGroup() const;
+	/// @brief Setter del grupo
+	/// @param newGroup El nuevo grupo; vacio para ninguno.
+	void setGroup(const std::string& newGroup);
+	/// @brief Getter del CPU preferido (afinidad suave: se respeta si el CPU esta libre).
+	/// @return El CPU; -1 si no tiene.
+	int getAffinity() const;
+	/// @brief Setter del CPU preferido
+	/// @param newAffinity El nuevo CPU; -1 para ninguno.
+	void setAffinity(int newAffinity);
+	/// @brief Getter del identificador del proceso. Lo asigna el planificador al admitirlo y lo comparten todas sus copias,
+	/// asi que distingue a dos procesos con el mismo nombre y prioridad.
+	/// @return El identificador; 0 si el proceso no se ha admitido.
+	unsigned long long getId() const;
+	/// @brief Setter del identificador
+	/// @param newId El nuevo identificador; 0 para ninguno.
+	void setId(unsigned long long newId);
 
 
-  /// @brief Añade una nueva instruccion al proceso.
+  /// @brief Añade una nueva instruccion al proceso, internando su texto en el InstructionDictionary.
   /// @param instruction La nueva instruccion que se va a añadir.
-  void addInstruction(const std::string instruction);
+  void addInstruction(const std::string& instruction);
+  /// @brief Añade una nueva instruccion ya internada al proceso, con su costo predeterminado.
+  /// @param instructionId El ID de la instruccion en el InstructionDictionary.
+  void addInstruction(int instructionId);
+  /// @brief Añade una nueva instruccion ya internada al proceso, con el costo y el dispositivo que le asigna el CostModel de la carga.
+  /// Si el programa esta compartido, primero lo copia.
+  /// @param instructionId El ID de la instruccion en el InstructionDictionary.
+  /// @param cost El costo de la instruccion en ciclos.
+  /// @param device El dispositivo de E/S de la instruccion.
+  void addInstruction(int instructionId, double cost, int device = CostModel::DEFAULT_DEVICE);
   /// @brief Simula la ejecucion de la siguiente instruccion en la lista.
   /// @return True si logra ejecutarla; false si el proceso se corta (quantum insuficiente) o se bloquea (E/S).
   bool executeNextInstruction();
+  /// @brief Ejecuta de una vez la rafaga de instrucciones normales consecutivas que caben en el quantum restante,
+  /// avanzando el indice, el quantum y el reloj en bloque. Se detiene antes de la siguiente E/S o de la primera instruccion que no cabe,
+  /// que quedan para executeNextInstruction.
+  /// @return La cantidad de instrucciones ejecutadas.
+  int executeBurst();
   /// @brief Revisa si quedan instrucciones en el proceso.
   /// @return True si sí; false si no.
   bool hasMoreInstrucions() const;
   /// @brief Reinicia la ejecucion del proceso al principio.
   void resetExecution();
 
+  /// @brief Cuenta las instrucciones de E/S desde una posicion hasta el final, en O(1).
+  /// @param fromIndex La posicion inicial (indexada desde 1).
+  /// @return La cantidad de instrucciones de E/S restantes.
+  int countIOInstructions(int fromIndex) const;
+  /// @brief Cuenta las instrucciones normales desde una posicion hasta el final, en O(1).
+  /// @param fromIndex La posicion inicial (indexada desde 1).
+  /// @return La cantidad de instrucciones normales restantes.
+  int countCPUInstructions(int fromIndex) const;
+  /// @brief Calcula, en O(1), la prioridad que resulta de aplicar las instrucciones desde una posicion hasta el final:
+  /// +1 por instruccion normal (hasta MAX_PRIORITY) y -1 por E/S (hasta MIN_PRIORITY).
+  /// @param basePriority La prioridad de la que se parte.
+  /// @param fromIndex La posicion inicial (indexada desde 1).
+  /// @return La prioridad resultante.
+  int projectPriority(int basePriority, int fromIndex) const;
+
   /// @brief Revisa si el proceso esta bloqueado (en E/S).
   /// @return True si sí; false si no.
   bool isInIO() const;
@@ -115,14 +248,14 @@ class Process {
   /// @return True si este tiene mayor prioridad que el otro; false si no.
   bool operator>(const Process& other);
   
-  /// @brief Metodo multiplataforma para pausar el programa durante una cierta cantidad de segundos.
+  /// @brief Metodo multiplataforma para pausar el programa durante una cierta cantidad de segundos (en tiempo virtual solo adelanta el SimulationClock).
   /// @param seconds Los segundos por los que el programa debe de pausarse.
   void sleepInSeconds(float seconds);
 	
 	// Sobrecarga de operadores de comparacion para comparar procesos usando su prioridad como criterio
 	bool operator<(const Process& other) const;
 	bool operator>(const Process& other) const;
-	// == en particular usa la prioridad y el nombre del proceso
+	// == en particular usa el identificador si ambos procesos ya fueron admitidos; si no, la prioridad y el nombre del proceso
 	bool operator==(const Process& other) const;
 	bool operator!=(const Process& other) const;
 	bool operator<=(const Process& other) const;
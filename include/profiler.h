@@ -0,0 +1,97 @@
+#pragma once
+
+#include <chrono>
+#include <iostream>
+#include <string>
+
+/// @brief Fases instrumentadas del ciclo de planificacion.
+enum class ProfilePhase {
+  SELECT_NEXT_PROCESS,
+  EXECUTE_QUANTUM,
+  CHECK_BLOCKED_PROCESSES,
+  MOVE_TO_READY,
+  MOVE_TO_BLOCKED,
+  MOVE_TO_FINISHED,
+  COUNT
+};
+
+/// @brief Instrumentacion del camino caliente del planificador.
+/// Solo existe si se compila con SCHEDULER_PROFILING (make PROFILE=1); si no, PROFILE_SCOPE no genera codigo y los metodos estaticos son vacios.
+/// Por fase acumula llamadas, tiempo total/minimo/maximo, un histograma de duraciones en potencias de 2 y, opcionalmente,
+/// contadores de hardware (ciclos, instrucciones, fallos de cache) leidos con perf_event_open. Tambien guarda cada intervalo para
+/// exportarlo como JSON de trace events de Chrome (chrome://tracing, Perfetto). No es seguro entre hilos: solo lo usa el hilo del planificador.
+class Profiler {
+  public:
+    /// @brief Cantidad de cubetas del histograma: la cubeta i cuenta duraciones en [2^i, 2^(i+1)) nanosegundos.
+    static const int HISTOGRAM_BUCKETS = 40;
+    /// @brief Cantidad maxima de intervalos que se guardan para el trace; los demas solo se cuentan.
+    static const int TRACE_CAPACITY = 1 << 18;
+
+    /// @brief Revisa si la instrumentacion fue compilada.
+    /// @return true si se compilo con SCHEDULER_PROFILING; false si no.
+    static bool isEnabled();
+    /// @brief Intenta abrir los contadores de hardware con perf_event_open. Si el sistema no lo permite, se sigue sin contadores.
+    /// @return true si los contadores quedaron abiertos; false si no.
+    static bool enablePerfCounters();
+    /// @brief Descarta todo lo registrado.
+    static void reset();
+    /// @brief Imprime, por fase, las llamadas, los tiempos, los contadores y el histograma de duraciones.
+    /// @param os El stream de salida.
+    static void printSummary(std::ostream& os);
+    /// @brief Escribe los intervalos registrados como JSON de trace events de Chrome.
+    /// @param filename El archivo de salida.
+    /// @return true si logro escribirlo; false si no (o si la instrumentacion no fue compilada).
+    static bool writeChromeTrace(const std::string& filename);
+    /// @brief Nombre legible de una fase.
+    /// @param phase La fase.
+    /// @return Su nombre.
+    static const char* phaseName(ProfilePhase phase);
+
+#ifdef SCHEDULER_PROFILING
+    /// @brief Lee los contadores de hardware abiertos.
+    /// @param values Arreglo de 3 valores: ciclos, instrucciones y fallos de cache. Quedan en 0 si no hay contadores.
+    static void readCounters(unsigned long long values[3]);
+    /// @brief Registra un intervalo de una fase.
+    /// @param phase La fase.
+    /// @param start Inicio del intervalo.
+    /// @param end Fin del intervalo.
+    /// @param startCounters Contadores al inicio.
+    /// @param endCounters Contadores al final.
+    static void record(ProfilePhase phase, std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end,
+      const unsigned long long startCounters[3], const unsigned long long endCounters[3]);
+#endif
+};
+
+#ifdef SCHEDULER_PROFILING
+/// @brief Temporizador con alcance: mide desde su construccion hasta su destruccion y lo registra en el Profiler.
+class ProfileScope {
+  private:
+    ProfilePhase phase;
+    std::chrono::steady_clock::time_point start;
+    unsigned long long startCounters[3];
+
+  public:
+    /// @brief Constructor parametrizado. Empieza a medir.
+    /// @param newPhase La fase que se mide.
+    ProfileScope(ProfilePhase newPhase) : phase(newPhase) {
+      Profiler::readCounters(startCounters);
+      start = std::chrono::steady_clock::now();
+    }
+    /// @brief Destructor. Termina de medir y registra el intervalo.
+    ~ProfileScope() {
+      std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+      unsigned long long endCounters[3];
+      Profiler::readCounters(endCounters);
+      Profiler::record(phase, start, end, startCounters, endCounters);
+    }
+    ProfileScope(const ProfileScope& other) = delete;
+    ProfileScope& operator=(const ProfileScope& other) = delete;
+};
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+/// @brief Mide el resto del bloque actual como la fase indicada.
+#define PROFILE_SCOPE(phase) ProfileScope PROFILE_CONCAT(profileScope, __LINE__)(phase)
+#else
+#define PROFILE_SCOPE(phase)
+#endif
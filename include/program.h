@@ -0,0 +1,122 @@
+#pragma once
+
+#include <atomic>
+#include <costModel.h>
+
+/// @brief Resume el efecto de una secuencia de instrucciones sobre la prioridad de un proceso.
+/// Cada instruccion suma o resta 1 y satura en un extremo, y la composicion de esos pasos siempre tiene la forma
+/// min(ceiling, max(floor, prioridad + shift)), por lo que se puede evaluar en O(1).
+struct PriorityTransform {
+  int shift;
+  int floor;
+  int ceiling;
+};
+
+/// @brief Programa de un proceso: los IDs de sus instrucciones, el costo y el dispositivo ya resueltos de cada una y el perfil que se calcula a partir de ellos.
+/// Se comparte entre todas las copias de un Process con un contador de referencias, asi que copiar un proceso es O(1)
+/// sin importar el largo del programa. Un programa compartido es inmutable: Process lo copia antes de modificarlo (copy-on-write).
+class Program {
+  private:
+    std::atomic<int> references;
+    int* instructions;                            // IDs de las instrucciones en el InstructionDictionary
+    double* costs;                                // costs[i]: costo en ciclos de la instruccion i + 1, resuelto al cargarla
+    int* devices;                                 // devices[i]: dispositivo de E/S de la instruccion i + 1 (indice del CostModel)
+    int count;
+    int capacity;
+
+    // perfil de instrucciones: se construye una sola vez, antes de compartir el programa o en la primera consulta
+    mutable int* ioPrefix;                        // ioPrefix[i]: instrucciones de E/S entre la 1 y la i
+    mutable PriorityTransform* priorityTransforms; // priorityTransforms[i]: efecto de las instrucciones i..n
+    mutable double* costPrefix;                   // costPrefix[i]: costo total de las instrucciones 1..i
+    mutable int* nextIO;                          // nextIO[i]: primera instruccion de E/S en i..n; n + 1 si no hay
+    mutable int profileSize;                      // cantidad de instrucciones cubiertas por el perfil; -1 si no existe
+
+    /// @brief Constructor de Program. Solo se crean con create() o clone(), ya con una referencia.
+    Program();
+    /// @brief Destructor de Program. Solo lo llama release() al soltar la ultima referencia.
+    ~Program();
+    /// @brief Libera el perfil de instrucciones.
+    void clearProfile() const;
+
+  public:
+    /// @brief Prioridad minima que puede alcanzar un proceso al recalcular su prioridad.
+    static constexpr int MIN_PRIORITY = 0;
+    /// @brief Prioridad maxima que puede alcanzar un proceso al recalcular su prioridad.
+    static constexpr int MAX_PRIORITY = 10;
+    /// @brief Holgura, en ciclos, con la que una instruccion cabe en el quantum que queda. Absorbe el redondeo de los costos fraccionarios,
+    /// que una rafaga suma como prefijos y la ejecucion paso a paso resta uno por uno, para que ambas corten el quantum en la misma instruccion.
+    static constexpr double COST_TOLERANCE = 1e-9;
+
+    Program(const Program& other) = delete;
+    Program& operator=(const Program& other) = delete;
+
+    /// @brief Crea un programa vacio con una referencia.
+    /// @return El nuevo programa.
+    static Program* create();
+    /// @brief Obtiene una referencia al programa vacio compartido, para procesos sin instrucciones (no reserva memoria).
+    /// @return El programa vacio.
+    static Program* empty();
+    /// @brief Crea una copia privada de este programa, con una referencia.
+    /// @return La copia.
+    Program* clone() const;
+    /// @brief Toma una referencia mas al programa. Construye antes el perfil, porque un programa compartido no se modifica.
+    /// @return Este programa.
+    Program* retain();
+    /// @brief Suelta una referencia; libera el programa al soltar la ultima.
+    void release();
+    /// @brief Revisa si otro proceso tambien usa este programa.
+    /// @return true si tiene mas de una referencia; false si no.
+    bool isShared() const;
+
+    /// @brief Añade una instruccion al final. Solo se debe llamar sobre un programa que no esta compartido.
+    /// @param instructionId El ID de la instruccion en el InstructionDictionary.
+    /// @param cost El costo de la instruccion en ciclos.
+    /// @param device El dispositivo de E/S de la instruccion (CostModel::DEFAULT_DEVICE si no es de E/S).
+    void append(int instructionId, double cost, int device);
+    /// @brief Getter de la cantidad de instrucciones.
+    /// @return La cantidad de instrucciones.
+    int getCount() const;
+    /// @brief Getter del ID de una instruccion.
+    /// @param index La posicion de la instruccion (indexada desde 1).
+    /// @return El ID; -1 si no existe esa posicion.
+    int getId(int index) const;
+    /// @brief Getter de los IDs de todas las instrucciones.
+    /// @return El arreglo de IDs (getCount() elementos); nullptr si no hay instrucciones.
+    const int* getIds() const;
+    /// @brief Getter del costo de una instruccion.
+    /// @param index La posicion de la instruccion (indexada desde 1).
+    /// @return El costo en ciclos; 0 si no existe esa posicion.
+    double getCost(int index) const;
+    /// @brief Getter del dispositivo de E/S de una instruccion.
+    /// @param index La posicion de la instruccion (indexada desde 1).
+    /// @return El indice del dispositivo; CostModel::DEFAULT_DEVICE si no existe esa posicion.
+    int getDevice(int index) const;
+
+    /// @brief Construye el perfil de instrucciones si no existe o si quedo desactualizado.
+    void buildProfile() const;
+    /// @brief Cuenta las instrucciones de E/S desde una posicion hasta el final, en O(1).
+    /// @param fromIndex La posicion inicial (indexada desde 1).
+    /// @return La cantidad de instrucciones de E/S restantes.
+    int countIOInstructions(int fromIndex) const;
+    /// @brief Cuenta las instrucciones normales desde una posicion hasta el final, en O(1).
+    /// @param fromIndex La posicion inicial (indexada desde 1).
+    /// @return La cantidad de instrucciones normales restantes.
+    int countCPUInstructions(int fromIndex) const;
+    /// @brief Calcula, en O(1), la prioridad que resulta de aplicar las instrucciones desde una posicion hasta el final:
+    /// +1 por instruccion normal (hasta MAX_PRIORITY) y -1 por E/S (hasta MIN_PRIORITY).
+    /// @param basePriority La prioridad de la que se parte.
+    /// @param fromIndex La posicion inicial (indexada desde 1).
+    /// @return La prioridad resultante.
+    int projectPriority(int basePriority, int fromIndex) const;
+    /// @brief Busca, en O(log n), hasta donde llega una rafaga de instrucciones normales consecutivas que caben en un quantum:
+    /// se detiene antes de la siguiente E/S o de la primera instruccion cuyo costo ya no cabe (con COST_TOLERANCE, como Process::fitsInQuantum).
+    /// @param fromIndex La posicion inicial (indexada desde 1).
+    /// @param quantum El quantum disponible.
+    /// @return La primera posicion que no entra en la rafaga (fromIndex si no cabe ninguna).
+    int findBurstEnd(int fromIndex, double quantum) const;
+    /// @brief Suma, en O(1), el costo de un rango de instrucciones.
+    /// @param fromIndex La primera posicion del rango (indexada desde 1).
+    /// @param toIndex La primera posicion despues del rango.
+    /// @return El costo total en ciclos.
+    double getCostBetween(int fromIndex, int toIndex) const;
+};
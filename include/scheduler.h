@@ -1,26 +1,199 @@
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <iostream>
+#include <mutex>
+#include <costModel.h>
+#include <ioDevice.h>
+#include <latencyHistogram.h>
+#include <mpscQueue.hxx>
+#include <nativeBackend.h>
 #include <process.h>
-#include <timer.h>
+#include <simulationClock.h>
+#include <statusServer.h>
+#include <timeline.h>
+#include <binaryHeap.hxx>
 #include <binarySearchTree.hxx>
 
 /// @brief Clase Scheduler para planificar la ejecucion de los proceso, asi como realizar la ejecucion
 class Scheduler {
   protected:
-    SinglyLinkedList<Process>* readyQueue;      
-    SinglyLinkedList<Process>* blockedQueue;     
     SinglyLinkedList<Process>* finishedProcesses;
     
     Process* currentProcess;            
-		Timer* ioTimer;
+		/// @brief Dispositivos de E/S, cada uno con su cola de procesos bloqueados; devices[0] es el predeterminado
+		IODevice** devices;
+		int deviceCount;
+
+		/// @brief Procesos enviados desde otros hilos mientras el planificador corre; se admiten en cada punto de planificacion
+		MPSCQueue<Process>* submissionQueue;
+		/// @brief Indica si run() debe seguir esperando procesos nuevos aunque ya no queden procesos por terminar
+		std::atomic<bool> acceptingSubmissions;
+		/// @brief Envios que ya empezaron y todavia no terminan de entrar a submissionQueue
+		std::atomic<int> submissionsInFlight;
+		/// @brief Despierta al planificador ocioso cuando llega un envio o se cierran los envios
+		std::condition_variable submissionSignal;
+		/// @brief Mutex de submissionSignal; solo lo toma el hilo del planificador
+		std::mutex submissionMutex;
+		/// @brief Backend opcional que ejecuta los comandos reales de los procesos; nullptr para solo simular
+		NativeBackend* nativeBackend;
+
+		/// @brief Momento del SimulationClock en que se creo el planificador; origen de su reloj
+		double startTime;
+		/// @brief Indica si se muestra el estado antes de cada instruccion; si no, en tiempo virtual las rafagas de CPU se ejecutan de una vez
+		bool instructionTrace;
+		/// @brief Semilla de los tiempos de servicio de los dispositivos de E/S
+		unsigned int seed;
+		/// @brief Stream donde se escribe la traza de eventos; nullptr si no se pidio
+		std::ostream* eventTrace;
+		/// @brief Linea de tiempo de la corrida; nullptr si no se pidio
+		Timeline* timeline;
+		/// @brief Costo de cada cambio de contexto, en segundos: el reloj avanza sin que ningun proceso progrese
+		double switchCost;
+		/// @brief Costo de recalentar la cache del proceso que entra, en segundos; se descuenta de su quantum
+		double warmupCost;
+		/// @brief Indica si se mantiene al proceso cortado cuando el siguiente tiene su misma prioridad
+		bool stickyEqualPriority;
+		/// @brief Cantidad de cambios de contexto cobrados y su costo total (cambio + calentamiento), en segundos
+		int switchCount;
+		double switchOverhead;
+		/// @brief Identificador del ultimo proceso despachado en cada CPU; 0 si todavia no se despacha ninguno
+		unsigned long long* lastDispatched;
+		/// @brief Identificador que recibe el siguiente proceso admitido
+		unsigned long long nextProcessId;
+		/// @brief Cantidad de CPUs; con mas de uno, run() despacha por rondas (ver runMultiCore)
+		int cpuCount;
+		/// @brief Tiempo que cada CPU paso ejecutando procesos, en segundos
+		double* cpuBusy;
+		/// @brief Despachos en un CPU distinto al anterior del proceso, y los que habria sin afinidad (proceso i de la ronda en el CPU i)
+		int migrations;
+		int migrationsWithoutAffinity;
+		/// @brief Tiempo total que cada proceso espero en la cola READY, registrado al terminar
+		LatencyHistogram* waitingHistogram;
+		/// @brief Tiempo desde la llegada de cada proceso hasta su primera ejecucion
+		LatencyHistogram* responseHistogram;
+		/// @brief Duracion de cada estadia de un proceso en la cola BLOCKED
+		LatencyHistogram* blockedHistogram;
+		/// @brief Retraso de cada proceso que termino despues de su plazo
+		LatencyHistogram* latenessHistogram;
+		/// @brief Cantidad de procesos con plazo que terminaron, y cuantos de ellos incumplieron su plazo
+		int deadlineCount;
+		int deadlineMisses;
+		/// @brief Servidor del estado en vivo; nullptr si no se pidio
+		StatusServer* statusServer;
+		/// @brief Cantidad de fotos publicadas en el servidor de estado
+		unsigned long long statusCount;
+		/// @brief Resumen de los histogramas (espera, respuesta, bloqueo y retraso) que llevan las fotos, y cuando se calculo.
+		/// Los percentiles recorren todos los buckets, asi que se recalculan a lo mas cada STATUS_REFRESH_MS de tiempo real, no en cada quantum
+		StatusLatency statusLatencies[4];
+		std::chrono::steady_clock::time_point statusRefreshedAt;
+		static constexpr int STATUS_REFRESH_MS = 10;
+		/// @brief Indica si run() usa el ciclo generico (runLoop de Scheduler) en lugar del ciclo especializado del algoritmo
+		bool dynamicDispatch;
 
     /// @brief Metodo abstracto para ser modificado por clases hijas
     virtual void selectNextProcess() = 0;
+    /// @brief Ciclo de run() con un CPU: revisa los bloqueados, ejecuta el quantum, admite los envios y escoge el siguiente proceso.
+    /// Esta version llama a los metodos del algoritmo por la tabla virtual; SchedulerCore la reemplaza por una sin llamadas virtuales.
+    virtual void runLoop();
+    /// @brief Implementacion unica de runLoop, executeQuantum y checkBlockedProcesses. Llaman a los metodos del algoritmo sobre self:
+    /// con Self = Scheduler pasan por la tabla virtual; con un SchedulerCore sus metodos son final y el compilador las resuelve y expande.
+    /// @param self Este planificador, con el tipo por el que se hacen las llamadas
+    template <typename Self>
+    void runLoopWith(Self& self);
+    template <typename Self>
+    void executeQuantumWith(Self& self);
+    template <typename Self>
+    void checkBlockedProcessesWith(Self& self);
+    /// @brief Ejecuta las instrucciones del proceso actual que caben en su quantum, por rafagas si se puede (ver setInstructionTrace)
+    void executeInstructions();
+    /// @brief Bloquea el hilo del planificador, sin ocupar el CPU, hasta que llegue un envio o se cierren los envios.
+    /// submitProcess no toma el mutex, asi que un aviso se puede perder: la espera se corta a los pocos milisegundos por si acaso.
+    void waitForSubmissions();
+    /// @brief Cobra el cambio de contexto y marca como activo al proceso que se acaba de escoger, si hay
+    void startCurrentProcess();
+    /// @brief Reloj del planificador.
+    /// @return Los segundos transcurridos desde que se creo el planificador
+    double now() const;
+    /// @brief En tiempo virtual, adelanta el reloj hasta un momento dado si todavia no llego; en tiempo real no hace nada.
+    /// Sirve para que el planificador ocioso salte al final de la siguiente operacion de E/S.
+    /// @param time El momento, en segundos del reloj del planificador
+    void waitUntil(double time);
+    /// @brief Escribe un evento en la traza de eventos, si hay una: "<microsegundos> <evento> <proceso>[ <detalle>]".
+    /// En modo deterministico los tiempos son virtuales, asi que dos corridas con la misma semilla dan la misma traza.
+    /// @param event El nombre del evento
+    /// @param process El proceso del evento
+    /// @param detail Informacion adicional, p. ej. el dispositivo de E/S
+    void recordEvent(const char* event, const Process& process, const std::string& detail = "");
+    /// @brief Registra en la linea de tiempo, si hay una, que un proceso cambia de estado
+    /// @param process El proceso
+    /// @param state El nuevo estado
+    /// @param cpu El CPU, si el nuevo estado es RUNNING
+    void recordTransition(const Process& process, TimelineState state, int cpu = 0);
+    /// @brief Cobra el cambio de contexto si el proceso actual no es el ultimo que se despacho en su CPU
+    /// @param cpu El CPU en que se despacha
+    void chargeContextSwitch(int cpu = 0);
+    /// @brief Marca la llegada de un proceso al planificador y le asigna su identificador
+    /// @param process El proceso que llega
+    void noteArrival(Process& process);
+    /// @brief Marca la entrada de un proceso a READY; si venia de BLOCKED registra cuanto estuvo bloqueado.
+    /// Debe llamarse antes de cambiar el estado del proceso.
+    /// @param process El proceso que pasa a READY
+    void noteReady(Process& process);
+    /// @brief Marca la entrada de un proceso a BLOCKED
+    /// @param process El proceso que se bloquea
+    void noteBlocked(Process& process);
+    /// @brief Marca que un proceso empieza a ejecutarse: acumula su espera y, si es la primera vez, registra su tiempo de respuesta
+    /// @param process El proceso que se ejecuta
+    /// @param cpu El CPU en que se ejecuta
+    void noteDispatch(Process& process, int cpu = 0);
+    /// @brief Marca que un proceso termino y registra su tiempo total de espera
+    /// @param process El proceso que termina
+    void noteFinished(Process& process);
+    /// @brief Ejecuta el comando real del proceso actual en el backend nativo durante su quantum
+    void executeNativeQuantum();
     /// @brief Corta el proceso actual
     void preemptCurrentProcess();
-    /// @brief Revisa si hay procesos bloqueados, y desbloquea alguno si ya paso el tiempo necesario
+    /// @brief Revisa los dispositivos de E/S y desbloquea los procesos cuya operacion ya termino
     void checkBlockedProcesses();
+    /// @brief Cantidad de procesos bloqueados en todos los dispositivos
+    /// @return La cantidad de procesos
+    int getBlockedCount() const;
+    /// @brief Obtiene el proceso bloqueado que va a terminar primero su operacion de E/S
+    /// @return El proceso; nullptr si no hay procesos bloqueados
+    Process* peekBlockedProcess();
+    /// @brief Libera los dispositivos de E/S
+    void clearDevices();
+    /// @brief Publica una foto del estado en el servidor de estado, si hay. run() la publica una vez por quantum;
+    /// los resumenes de los histogramas pueden llegar hasta STATUS_REFRESH_MS atrasados, salvo en la ultima foto.
+    /// @param finished true para la ultima foto, al terminar la corrida
+    void publishStatus(bool finished = false);
+    /// @brief Metodo virtual puro. Quantum con que el algoritmo despacha cada proceso
+    /// @return El quantum
+    virtual float getQuantumSlice() const = 0;
+    /// @brief Metodo virtual puro. Saca el siguiente proceso listo segun el algoritmo, para despacharlo en una ronda de varios CPUs.
+    /// @param out Donde se deja el proceso
+    /// @return true si habia un proceso listo; false si no
+    virtual bool popReady(Process& out) = 0;
+    /// @brief Metodo virtual puro. Saca el primer proceso listo de un grupo, segun el orden del algoritmo
+    /// @param group El grupo
+    /// @param out Donde se deja el proceso
+    /// @return true si habia un proceso listo del grupo; false si no
+    virtual bool takeReady(const std::string& group, Process& out) = 0;
+    /// @brief Metodo virtual puro. Quita un proceso de la cola READY del algoritmo, si esta
+    /// @param process El proceso
+    virtual void removeReady(const Process& process) = 0;
+    /// @brief Escoge los procesos de una ronda y el CPU de cada uno.
+    /// Los procesos salen en el orden del algoritmo; cuando sale uno con grupo, los demas procesos listos de su grupo entran en la misma
+    /// ronda mientras haya CPUs libres. Cada proceso va a su CPU preferido o, si no tiene, al ultimo en que corrio, si esta libre.
+    /// @param assigned El proceso de cada CPU; nullptr si el CPU queda libre. El llamador libera los procesos.
+    /// @return La cantidad de procesos despachados
+    int fillRound(Process** assigned);
+    /// @brief Ciclo de run() con varios CPUs: en cada ronda despacha hasta cpuCount procesos a la vez, ejecuta el quantum de cada uno
+    /// desde el inicio de la ronda (en tiempo virtual) y cierra la ronda cuando termina el ultimo.
+    void runMultiCore();
 
   public:
     /// @brief Constructor predeterminado
@@ -31,9 +204,29 @@ class Scheduler {
 		/// @brief Procesa todos los procesos segun el algoritmo seleccionado
 		void run();
 
-    /// @brief Metodo virtual para añadir procesos
+    /// @brief Metodo virtual puro para añadir procesos
     /// @param newProcess El nuevo proceso que se añade
-    virtual void addProcess(Process* newProcess);
+    virtual void addProcess(Process* newProcess) = 0;
+    /// @brief Metodo virtual para añadir de una vez todos los procesos de una carga (p. ej. los del FileParser), en el orden de la lista.
+    /// Por defecto añade una copia de cada uno con addProcess.
+    /// @param processes Los procesos que se añaden
+    virtual void addProcesses(const SinglyLinkedList<Process>& processes);
+    /// @brief Envia un proceso al planificador desde cualquier hilo, sin bloquear ni tomar un mutex.
+    /// El proceso se admite (con addProcess) en el siguiente punto de planificacion de run(). No se debe llamar despues de closeSubmissions.
+    /// @param newProcess El nuevo proceso que se envia
+    void submitProcess(const Process& newProcess);
+    /// @brief Admite todos los procesos enviados con submitProcess. Solo debe llamarse desde el hilo del planificador.
+    /// @return La cantidad de procesos admitidos
+    int admitSubmittedProcesses();
+    /// @brief Hace que run() siga corriendo, esperando procesos nuevos, aunque se vacien las colas
+    void openSubmissions();
+    /// @brief Permite que run() termine en cuanto no queden procesos por terminar ni por admitir.
+    /// Los envios que empezaron antes de llamarlo se esperan hasta que entran a la cola, aunque su hilo todavia este en submitProcess;
+    /// los que empiezan despues pueden perderse, asi que cada productor debe terminar de enviar (o unirse) antes de cerrar.
+    void closeSubmissions();
+    /// @brief Revisa si todavia pueden llegar procesos enviados desde otros hilos
+    /// @return true si se siguen aceptando envios o si quedan envios por admitir; false si no
+    bool hasPendingSubmissions() const;
     /// @brief Elimina un proceso de la cola en la que se encuentra
     /// @param process El proceso a eliminar
     void removeProcess(Process* process);
@@ -47,9 +240,9 @@ class Scheduler {
     /// @param newState El estado al que el proceso cambia
     void handleProcessStateChange(Process* process, ProcessState newState);
 
-    /// @brief Mueve un proceso a la cola READY
+    /// @brief Metodo virtual puro. Mueve un proceso a la cola READY
     /// @param process El proceso que se mueve
-    virtual void moveToReady(Process* process);
+    virtual void moveToReady(Process* process) = 0;
     /// @brief Mueve un proceso a la cola BLOCKED
     /// @param process El proceso que se mueve
     void moveToBlocked(Process* process);
@@ -60,70 +253,407 @@ class Scheduler {
     /// @brief Metodo abstracto para ser modificado por las clases hijas
     /// @return true si hay procesos sin terminar; false si no
     virtual bool hasUnfinishedProcesses() = 0;
-		/// @brief Reinicia el timer de entrada y salida
-		void clearTimer();
+		/// @brief Crea un dispositivo de E/S por cada uno del modelo de costos de la carga, reemplazando los actuales.
+		/// Debe llamarse antes de que haya procesos bloqueados.
+		/// @param model El modelo de costos
+		void setDevices(const CostModel& model);
+		/// @brief Getter de la cantidad de dispositivos de E/S
+		/// @return La cantidad de dispositivos
+		int getDeviceCount() const;
+		/// @brief Getter de un dispositivo de E/S
+		/// @param index El indice del dispositivo en el modelo de costos
+		/// @return El dispositivo
+		const IODevice& getDevice(int index) const;
     /// @brief Metodo abstracto para ser modificado por las clases hijas
     virtual void displayStatus() = 0;
+    /// @brief Metodo abstracto para ser modificado por las clases hijas
+    /// @return La cantidad de procesos en la cola READY del algoritmo
+    virtual int getReadyCount() const = 0;
+
+		/// @brief Setter del backend nativo. El planificador pasa a ser dueño del backend.
+		/// @param newBackend El nuevo backend; nullptr para volver a simular todos los procesos
+		void setNativeBackend(NativeBackend* newBackend);
+		/// @brief Getter del backend nativo
+		/// @return El backend nativo, o nullptr si no hay
+		NativeBackend* getNativeBackend();
+
+		/// @brief Escoge el ciclo de run() con un CPU: el especializado del algoritmo (SchedulerCore, por defecto) o el generico de Scheduler,
+		/// que pasa por la tabla virtual en cada paso. Los dos dan la misma corrida; el generico sirve para medir la diferencia (make benchmark).
+		/// @param enabled true para usar el ciclo generico; false para el especializado
+		void setDynamicDispatch(bool enabled);
+		/// @brief Getter del ciclo de run()
+		/// @return true si usa el ciclo generico; false si usa el especializado
+		bool hasDynamicDispatch() const;
+
+		/// @brief Activa o desactiva la traza por instruccion (UI::presentState antes de cada una).
+		/// Sin traza y en tiempo virtual, executeQuantum ejecuta cada rafaga de instrucciones normales en un solo paso.
+		/// @param enabled true para mostrar cada instruccion; false para ejecutar por rafagas
+		void setInstructionTrace(bool enabled);
+		/// @brief Getter de la traza por instruccion
+		/// @return true si se muestra cada instruccion; false si no
+		bool hasInstructionTrace() const;
+
+		/// @brief Setter de la semilla de los tiempos de servicio; reinicia los generadores de los dispositivos
+		/// @param newSeed La nueva semilla
+		void setSeed(unsigned int newSeed);
+		/// @brief Getter de la semilla
+		/// @return La semilla
+		unsigned int getSeed() const;
+		/// @brief Setter del stream de la traza de eventos. El planificador no se vuelve dueño del stream.
+		/// @param stream El stream; nullptr para no escribir la traza
+		void setEventTrace(std::ostream* stream);
+		/// @brief Setter de la linea de tiempo. El planificador pasa a ser dueño de ella; run() la cierra al terminar.
+		/// Solo registra los procesos que lleguen despues de asignarla.
+		/// @param newTimeline La nueva linea de tiempo; nullptr para no registrarla
+		void setTimeline(Timeline* newTimeline);
+		/// @brief Getter de la linea de tiempo
+		/// @return La linea de tiempo, o nullptr si no hay
+		const Timeline* getTimeline() const;
+		/// @brief Setter del servidor de estado. El planificador pasa a ser dueño de el; lo detiene al destruirse.
+		/// Publica de una vez la primera foto.
+		/// @param newServer El nuevo servidor, ya iniciado; nullptr para no publicar el estado
+		void setStatusServer(StatusServer* newServer);
+		/// @brief Getter del servidor de estado
+		/// @return El servidor, o nullptr si no hay
+		StatusServer* getStatusServer();
+
+		/// @brief Setter de los costos de un cambio de contexto
+		/// @param newSwitchCost Segundos que se pierden en cada cambio
+		/// @param newWarmupCost Segundos de calentamiento de cache, descontados del quantum del proceso que entra
+		void setContextSwitchCost(double newSwitchCost, double newWarmupCost = 0);
+		/// @brief Activa o desactiva mantener al proceso cortado cuando el siguiente que escogeria el algoritmo tiene su misma prioridad
+		/// @param enabled true para evitar esos cambios de contexto; false para el comportamiento normal
+		void setStickyEqualPriority(bool enabled);
+		/// @brief Getter de la cantidad de cambios de contexto cobrados
+		/// @return La cantidad de cambios
+		int getSwitchCount() const;
+		/// @brief Getter del tiempo total perdido en cambios de contexto
+		/// @return Los segundos
+		double getSwitchOverhead() const;
+		/// @brief Imprime los cambios de contexto, su costo y cuanto rendimiento se pierde por ellos
+		/// @param os El stream de salida
+		void printSwitchReport(std::ostream& os) const;
+
+		/// @brief Setter de la cantidad de CPUs. Con mas de uno la simulacion debe correr en tiempo virtual,
+		/// porque cada CPU ejecuta su quantum desde el inicio de la ronda.
+		/// @param newCpuCount La nueva cantidad de CPUs, al menos 1
+		void setCpuCount(int newCpuCount);
+		/// @brief Getter de la cantidad de CPUs
+		/// @return La cantidad de CPUs
+		int getCpuCount() const;
+		/// @brief Getter de la cantidad de migraciones entre CPUs
+		/// @return La cantidad de migraciones
+		int getMigrations() const;
+		/// @brief Getter de la cantidad de migraciones que habria si cada proceso fuera al CPU de su posicion en la ronda
+		/// @return La cantidad de migraciones
+		int getMigrationsWithoutAffinity() const;
+		/// @brief Imprime la utilizacion de cada CPU y las migraciones que evito la afinidad
+		/// @param os El stream de salida
+		void printCpuReport(std::ostream& os) const;
 
 		/// @brief Getter de currentProcess
 		/// @return currentProcess
 		Process* getCurrent();
+
+		/// @brief Metodo abstracto para ser modificado por las clases hijas
+		/// @return El nombre del algoritmo de planificacion
+		virtual const char* getPolicyName() const = 0;
+		/// @brief Getter del histograma de tiempos de espera (microsegundos)
+		/// @return El histograma
+		const LatencyHistogram& getWaitingHistogram() const;
+		/// @brief Getter del histograma de tiempos de respuesta (microsegundos)
+		/// @return El histograma
+		const LatencyHistogram& getResponseHistogram() const;
+		/// @brief Getter del histograma de tiempos en la cola BLOCKED (microsegundos)
+		/// @return El histograma
+		const LatencyHistogram& getBlockedHistogram() const;
+		/// @brief Imprime los percentiles de espera, respuesta y bloqueo de la corrida
+		/// @param os El stream de salida
+		void printLatencyReport(std::ostream& os) const;
+		/// @brief Getter del histograma de retrasos de los plazos incumplidos (microsegundos)
+		/// @return El histograma
+		const LatencyHistogram& getLatenessHistogram() const;
+		/// @brief Getter de la cantidad de procesos con plazo que terminaron
+		/// @return La cantidad de procesos
+		int getDeadlineCount() const;
+		/// @brief Getter de la cantidad de plazos incumplidos
+		/// @return La cantidad de plazos
+		int getDeadlineMisses() const;
+		/// @brief Imprime los plazos cumplidos e incumplidos y la distribucion de los retrasos
+		/// @param os El stream de salida
+		void printDeadlineReport(std::ostream& os) const;
+		/// @brief Imprime la utilizacion y las esperas en cola de cada dispositivo de E/S
+		/// @param os El stream de salida
+		void printDeviceReport(std::ostream& os) const;
+};
+
+/// @brief Nucleo de un planificador, especializado en tiempo de compilacion para un algoritmo y su cola READY.
+/// El algoritmo (Policy) decide que proceso sigue y como vuelve a la cola; la cola (Queue) se guarda por valor dentro del nucleo.
+/// Los metodos del algoritmo quedan sellados (final) y runLoop los llama sin pasar por la tabla virtual, asi que el compilador
+/// puede expandirlos en linea en el ciclo de run(). Lo demas (E/S, envios, varios CPUs, backend nativo, reportes) sigue en Scheduler.
+/// @tparam Policy El algoritmo: una clase con select, hasUnfinished, admit, requeue, pop, take, remove y getQuantumSlice,
+/// que reciben el nucleo (ver RoundRobinPolicy). El nucleo es amigo del algoritmo para que este use su estado.
+/// @tparam Queue La cola READY del algoritmo; debe tener getSize() const
+template <typename Policy, typename Queue>
+class SchedulerCore : public Scheduler {
+	friend Policy;
+	// runLoopWith llama a los metodos protegidos del algoritmo sobre el SchedulerCore
+	friend class Scheduler;
+
+	protected:
+		/// @brief El algoritmo y sus parametros (p. ej. el quantum)
+		Policy policy;
+		/// @brief La cola READY
+		Queue ready;
+
+		/// @brief Metodo polimorfico. Escoge el siguiente proceso segun el algoritmo
+		void selectNextProcess() final;
+		/// @brief Metodo polimorfico.
+		/// @return El quantum del algoritmo
+		float getQuantumSlice() const final;
+		/// @brief Metodo polimorfico. Saca el siguiente proceso listo segun el algoritmo
+		/// @param out Donde se deja el proceso
+		/// @return true si habia un proceso listo; false si no
+		bool popReady(Process& out) final;
+		/// @brief Metodo polimorfico. Saca el primer proceso listo de un grupo segun el algoritmo
+		/// @param group El grupo
+		/// @param out Donde se deja el proceso
+		/// @return true si habia un proceso listo del grupo; false si no
+		bool takeReady(const std::string& group, Process& out) final;
+		/// @brief Metodo polimorfico. Quita un proceso de la cola READY
+		/// @param process El proceso
+		void removeReady(const Process& process) final;
+		/// @brief Metodo polimorfico. El mismo ciclo de Scheduler::runLoop (runLoopWith), con las llamadas al algoritmo resueltas en tiempo
+		/// de compilacion. Con setDynamicDispatch(true) usa el de Scheduler.
+		void runLoop() final;
+
+	public:
+		/// @brief Constructor parametrizado
+		/// @param newPolicy El algoritmo
+		/// @param newQueue La cola READY vacia (p. ej. un heap con su funcion de comparacion)
+		explicit SchedulerCore(const Policy& newPolicy = Policy(), const Queue& newQueue = Queue());
+
+		/// @brief Metodo polimorfico. Revisa si quedan procesos sin terminar segun el algoritmo
+		/// @return true si quedan procesos sin terminar; false si no
+		bool hasUnfinishedProcesses() final;
+		/// @brief Metodo polimorfico. Muestra el numero de procesos listos, bloqueados y terminados
+		void displayStatus() final;
+		/// @brief Metodo polimorfico.
+		/// @return La cantidad de procesos en la cola READY
+		int getReadyCount() const final;
+		/// @brief Metodo polimorfico. Añade un proceso a la cola READY segun el algoritmo
+		/// @param newProcess El nuevo proceso a añadir
+		void addProcess(Process* newProcess) final;
+		/// @brief Metodo polimorfico. Mueve un proceso a la cola READY segun el algoritmo
+		/// @param process El proceso que se mueve
+		void moveToReady(Process* process) final;
 };
 
-/// @brief Clase hija RoundRobin de Scheduler
-class RoundRobin : public Scheduler {
+/// @brief Algoritmo Round Robin para SchedulerCore: cola FIFO; el proceso despachado se queda al frente de la cola mientras corre
+/// y, si lo cortan, vuelve al final.
+class RoundRobinPolicy {
 	private:
-    SinglyLinkedList<Process>* preemptedQueue;     
 		float quantumSlice;
-		
-	protected:
-		/// @brief Metodo polimorfico. Selecciona el siguiente proceso en la cola READY (LIFO)
-		void selectNextProcess() override;
-	
+
 	public:
-		/// @brief Constructor predeterminado
-		RoundRobin();
-		/// @brief Destructor polimorfico
-		~RoundRobin() override;
-
-    /// @brief Metodo polimorfico. Revisa si hay procesos en la cola READY o en la cola BLOCKED
-    /// @return true si quedan procesos en alguna de esas colas; false si no
-    bool hasUnfinishedProcesses() override;
-    /// @brief Metodo polimorfico. Muestra el numero de procesos en las colas READY, BLOCKED, y FINISHED
-    void displayStatus() override;
+		/// @brief Constructor predeterminado. El quantum es de 5 ciclos.
+		RoundRobinPolicy();
+
+		/// @brief Getter del quantum
+		/// @return quantumSlice
+		float getQuantumSlice() const;
+		/// @brief Selecciona el siguiente proceso en la cola READY.
+		/// Con stickyEqualPriority, el proceso cortado sigue si el siguiente en la cola tiene su misma prioridad.
+		/// @param core El nucleo
+		template <typename Core> void select(Core& core);
+		/// @brief Revisa si hay procesos en la cola READY o bloqueados
+		/// @param core El nucleo
+		/// @return true si quedan procesos en alguna de esas colas; false si no
+		template <typename Core> bool hasUnfinished(Core& core);
+		/// @brief Añade un proceso al final de la cola
+		/// @param core El nucleo
+		/// @param newProcess El nuevo proceso
+		template <typename Core> void admit(Core& core, Process* newProcess);
+		/// @brief Devuelve un proceso al final de la cola
+		/// @param core El nucleo
+		/// @param process El proceso
+		template <typename Core> void requeue(Core& core, Process* process);
+		/// @brief Saca el primer proceso de la cola
+		/// @param core El nucleo
+		/// @param out Donde se deja el proceso
+		/// @return true si habia un proceso listo; false si no
+		template <typename Core> bool pop(Core& core, Process& out);
+		/// @brief Saca el primer proceso de un grupo
+		/// @param core El nucleo
+		/// @param group El grupo
+		/// @param out Donde se deja el proceso
+		/// @return true si habia un proceso listo del grupo; false si no
+		template <typename Core> bool take(Core& core, const std::string& group, Process& out);
+		/// @brief Quita un proceso de la cola
+		/// @param core El nucleo
+		/// @param process El proceso
+		template <typename Core> void remove(Core& core, const Process& process);
 };
 
-/// @brief Clase hija Priority de Scheduler
-class Priority : public Scheduler {
+/// @brief Algoritmo por prioridad para SchedulerCore: arbol de busqueda ordenado por prioridad; el proceso despachado se queda en el arbol
+/// mientras corre y su prioridad se recalcula cada vez que vuelve a READY.
+class PriorityPolicy {
+	public:
+		/// @brief Getter del quantum
+		/// @return 1024
+		float getQuantumSlice() const;
+		/// @brief Calcula la prioridad inicial de un proceso a partir de sus instrucciones
+		/// @param process El proceso
+		void calculateInitialPriority(Process& process);
+		/// @brief Reajusta la prioridad de un proceso segun las instrucciones que le quedan y lo inserta en el arbol
+		/// @param core El nucleo
+		/// @param process El proceso
+		template <typename Core> void adjustPriority(Core& core, Process& process);
+		/// @brief Selecciona el proceso con la prioridad mas alta.
+		/// Con stickyEqualPriority, el proceso cortado sigue si tiene la prioridad mas alta aunque empate con otro.
+		/// @param core El nucleo
+		template <typename Core> void select(Core& core);
+		/// @brief Revisa si hay procesos en el arbol o bloqueados
+		/// @param core El nucleo
+		/// @return true si quedan procesos en alguna de esas colas; false si no
+		template <typename Core> bool hasUnfinished(Core& core);
+		/// @brief Añade un proceso al arbol despues de calcular su prioridad inicial
+		/// @param core El nucleo
+		/// @param newProcess El nuevo proceso
+		template <typename Core> void admit(Core& core, Process* newProcess);
+		/// @brief Devuelve un proceso al arbol despues de reajustar su prioridad.
+		/// Si es el proceso cortado, antes quita del arbol la copia que tenia su prioridad anterior.
+		/// @param core El nucleo
+		/// @param process El proceso
+		template <typename Core> void requeue(Core& core, Process* process);
+		/// @brief Saca el proceso con la prioridad mas alta
+		/// @param core El nucleo
+		/// @param out Donde se deja el proceso
+		/// @return true si habia un proceso listo; false si no
+		template <typename Core> bool pop(Core& core, Process& out);
+		/// @brief Saca el proceso de un grupo con la prioridad mas alta
+		/// @param core El nucleo
+		/// @param group El grupo
+		/// @param out Donde se deja el proceso
+		/// @return true si habia un proceso listo del grupo; false si no
+		template <typename Core> bool take(Core& core, const std::string& group, Process& out);
+		/// @brief Quita un proceso del arbol
+		/// @param core El nucleo
+		/// @param process El proceso
+		template <typename Core> void remove(Core& core, const Process& process);
+};
+
+/// @brief Algoritmo de tiempo real para SchedulerCore: heap ordenado por una funcion de comparacion, asi que escoger el siguiente proceso
+/// toma O(log n). El proceso despachado sale del heap; cada quantum es un punto de expropiacion.
+class DeadlinePolicy {
 	private:
-		BinarySearchTree<Process>* priorityQueue;
+		BinaryHeap<Process>::Comparison before;
+		float quantumSlice;
 
-	protected:
-		/// @brief Metodo polimorfico. Selecciona el proceso con la prioridad mas alta en la cola de prioridad
-		void selectNextProcess() override;
-	
+	public:
+		/// @brief Constructor parametrizado. El quantum es de 5 ciclos.
+		/// @param newBefore La funcion que decide que proceso va primero
+		explicit DeadlinePolicy(BinaryHeap<Process>::Comparison newBefore);
+
+		/// @brief Getter del quantum
+		/// @return quantumSlice
+		float getQuantumSlice() const;
+		/// @brief Saca del heap el primer proceso segun la funcion de comparacion.
+		/// Con stickyEqualPriority, el proceso cortado sigue si el primero del heap no va estrictamente antes que el.
+		/// @param core El nucleo
+		template <typename Core> void select(Core& core);
+		/// @brief Revisa si hay procesos en el heap, en ejecucion o bloqueados
+		/// @param core El nucleo
+		/// @return true si quedan procesos sin terminar; false si no
+		template <typename Core> bool hasUnfinished(Core& core);
+		/// @brief Añade un proceso al heap
+		/// @param core El nucleo
+		/// @param newProcess El nuevo proceso
+		template <typename Core> void admit(Core& core, Process* newProcess);
+		/// @brief Devuelve un proceso al heap
+		/// @param core El nucleo
+		/// @param process El proceso
+		template <typename Core> void requeue(Core& core, Process* process);
+		/// @brief Saca el primer proceso del heap
+		/// @param core El nucleo
+		/// @param out Donde se deja el proceso
+		/// @return true si habia un proceso listo; false si no
+		template <typename Core> bool pop(Core& core, Process& out);
+		/// @brief Saca el proceso del grupo que va primero segun la funcion de comparacion
+		/// @param core El nucleo
+		/// @param group El grupo
+		/// @param out Donde se deja el proceso
+		/// @return true si habia un proceso listo del grupo; false si no
+		template <typename Core> bool take(Core& core, const std::string& group, Process& out);
+		/// @brief Quita un proceso del heap
+		/// @param core El nucleo
+		/// @param process El proceso
+		template <typename Core> void remove(Core& core, const Process& process);
+};
+
+#include <schedulerCore.tpp>
+
+/// @brief Clase hija RoundRobin de Scheduler: SchedulerCore con RoundRobinPolicy y una cola FIFO
+class RoundRobin : public SchedulerCore<RoundRobinPolicy, SinglyLinkedList<Process>> {
+	public:
+		/// @brief Constructor predeterminado
+		RoundRobin();
+
+    /// @brief Metodo polimorfico.
+    /// @return "Round Robin"
+    const char* getPolicyName() const override;
+};
+
+/// @brief Clase hija Priority de Scheduler: SchedulerCore con PriorityPolicy y un arbol de prioridad
+class Priority : public SchedulerCore<PriorityPolicy, BinarySearchTree<Process>> {
 	public:
 		/// @brief Constructor predeterminado
 		Priority();
-		/// @brief Destructor polimorfico
-		~Priority() override;
-		
-    /// @brief Metodo polimorfico. Revisa si hay procesos en la cola de prioridad o en la cola BLOCKED
-    /// @return true si quedan procesos en alguna de esas colas; false si no
-    bool hasUnfinishedProcesses() override;
-    /// @brief Metodo polimorfico. Muestra el numero de procesos en la cola de prioridad, ademas de el numero de procesos en las colas BLOCKED y FINISHED
-    void displayStatus() override;
+
+    /// @brief Metodo polimorfico.
+    /// @return "Prioridad"
+    const char* getPolicyName() const override;
 
 		/// @brief Calcula la prioridad inicial de un proceso a partir de sus instrucciones antes de insertarlo al arbol de prioridad
 		/// @param process El proceso cuya prioridad debe ser calculada
 		void calculateInitialPriority(Process& process);
-		/// @brief Metodo polimorfico. Añade un proceso a la cola de prioridad despues de calcular su prioridad inicial
-		/// @param newProcess El nuevo proceso a añadir
-		void addProcess(Process* newProcess) override;
+		/// @brief Metodo polimorfico. Admite un lote de procesos reconstruyendo el arbol de prioridad balanceado en O(n log n),
+		/// en lugar de insertarlos uno por uno (O(n^2) si llegan ordenados). El arbol queda con el mismo orden que dejarian las inserciones sucesivas.
+		/// @param processes Los procesos que se añaden, en orden de admision
+		void addProcesses(const SinglyLinkedList<Process>& processes) override;
 		/// @brief Reajusta la prioridad de un proceso segun las instrucciones que le quedan
 		/// @param process El proceso cuya prioridad debe ser reajustada
 		void adjustProcessPriority(Process& process);
-		/// @brief Mueve un proceso a la cola de prioridad despues de reajustar su prioridad
-		/// @param process El proceso que debe volver a la cola de prioridad
-		void moveToReady(Process* process) override;
-};
\ No newline at end of file
+};
+
+/// @brief Clase hija de Scheduler para los algoritmos de tiempo real: SchedulerCore con DeadlinePolicy y un heap binario
+class RealTimeScheduler : public SchedulerCore<DeadlinePolicy, BinaryHeap<Process>> {
+	public:
+		/// @brief Constructor parametrizado
+		/// @param newBefore La funcion que decide que proceso va primero
+		RealTimeScheduler(BinaryHeap<Process>::Comparison newBefore);
+};
+
+/// @brief Clase hija EarliestDeadlineFirst: escoge el proceso cuyo plazo absoluto (llegada + plazo) vence primero.
+/// Los procesos sin plazo van despues de todos los que tienen; los empates se resuelven por llegada y luego por nombre.
+class EarliestDeadlineFirst : public RealTimeScheduler {
+	public:
+		/// @brief Constructor predeterminado
+		EarliestDeadlineFirst();
+
+		/// @brief Metodo polimorfico.
+		/// @return "Plazo mas cercano (EDF)"
+		const char* getPolicyName() const override;
+};
+
+/// @brief Clase hija RateMonotonic: prioridad fija por periodo; el proceso con el periodo mas corto va primero.
+/// Un proceso sin periodo usa su plazo (deadline monotonic) y uno sin ninguno de los dos va al final.
+class RateMonotonic : public RealTimeScheduler {
+	public:
+		/// @brief Constructor predeterminado
+		RateMonotonic();
+
+		/// @brief Metodo polimorfico.
+		/// @return "Tasa monotona (RM)"
+		const char* getPolicyName() const override;
+};
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <atomic>
+#include <cstring>
+#include <type_traits>
+
+/// @brief Seqlock class: publishes a value from a single writer to any number of readers without locks.
+/// The writer never waits: it bumps a sequence number to an odd value, stores the value and bumps it again.
+/// A reader copies the value and retries if the sequence changed (or was odd) meanwhile, so it may spin while a write is in progress
+/// but never blocks the writer. The value is kept as an array of atomic words, so torn copies are discarded instead of being data races.
+/// @tparam T Template for the published data. Must be trivially copyable (no pointers to owned memory, no std::string).
+template <typename T>
+class Seqlock {
+  static_assert(std::is_trivially_copyable<T>::value, "Seqlock data must be trivially copyable");
+
+  private:
+    static const int WORD_COUNT = (sizeof(T) + sizeof(unsigned long long) - 1) / sizeof(unsigned long long);
+
+    std::atomic<unsigned long long> sequence;
+    std::atomic<unsigned long long> words[WORD_COUNT];
+
+  public:
+    /// @brief Seqlock constructor. Publishes a value-initialized T.
+    Seqlock();
+    Seqlock(const Seqlock& other) = delete;
+    Seqlock& operator=(const Seqlock& other) = delete;
+
+    /// @brief Publishes a new value. Must only be called from one thread at a time. Never waits.
+    /// @param data The value to publish.
+    void write(const T& data);
+    /// @brief Tries once to copy the published value.
+    /// @param out Where the value is copied to. Left unspecified if the read fails.
+    /// @return True if the copy is consistent; false if a write was in progress.
+    bool tryRead(T& out) const;
+    /// @brief Copies the published value, retrying while a write is in progress.
+    /// @return The value.
+    T read() const;
+    /// @brief Gets the amount of values published so far.
+    /// @return The amount of writes.
+    unsigned long long getVersion() const;
+};
+
+#include <seqlock.tpp>
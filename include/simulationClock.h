@@ -0,0 +1,35 @@
+#pragma once
+
+#include <atomic>
+
+/// @brief Reloj de la simulacion, compartido por el planificador y los procesos.
+/// En tiempo real (el modo predeterminado) el tiempo es el del reloj monotono del sistema y ejecutar una instruccion duerme de verdad.
+/// En tiempo virtual el reloj es solo un contador: ejecutar una instruccion lo adelanta al instante, asi que una carga completa
+/// se simula sin esperar y con los mismos tiempos en cada corrida.
+class SimulationClock {
+  private:
+    /// @brief Tiempo virtual en microsegundos (entero, para poder guardarlo en un atomic sin perder precision al sumar).
+    static std::atomic<long long> virtualMicroseconds;
+    static std::atomic<bool> virtualMode;
+
+  public:
+    /// @brief Cambia entre tiempo real y tiempo virtual.
+    /// @param enabled true para tiempo virtual; false para tiempo real.
+    static void setVirtual(bool enabled);
+    /// @brief Revisa si el reloj esta en tiempo virtual.
+    /// @return true si sí; false si no.
+    static bool isVirtual();
+    /// @brief Devuelve el tiempo virtual a 0.
+    static void reset();
+
+    /// @brief Tiempo actual del reloj.
+    /// @return Los segundos desde un origen fijo (el arranque del programa en tiempo real; el ultimo reset en tiempo virtual).
+    static double now();
+    /// @brief Deja pasar el tiempo: en tiempo real duerme; en tiempo virtual solo adelanta el reloj.
+    /// @param seconds Los segundos que pasan.
+    static void advance(double seconds);
+    /// @brief Pone el tiempo virtual en un momento dado, aunque sea anterior al actual; en tiempo real no hace nada.
+    /// Lo usa el planificador con varios CPUs para ejecutar el quantum de cada CPU desde el inicio de la ronda.
+    /// @param seconds Los segundos desde el ultimo reset.
+    static void setTime(double seconds);
+};
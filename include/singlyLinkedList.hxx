@@ -1,5 +1,11 @@
 #pragma once
 
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
 /// @brief SinglyLinkedListNode class for use in a singly linked list. Contains some data and a pointer to the next node in the list.
 /// @tparam T Template for use of generic data.
 template<typename T>
@@ -10,13 +16,22 @@ private:
 
     template <typename U>
     friend class SinglyLinkedList;
+    template <typename U, typename V>
+    friend class SinglyLinkedListIterator;
 
 public:
     /// @brief SinglyLinkedListNode constructor.
     SinglyLinkedListNode();
     /// @brief SinglyLinkedListNode parameterized constructor.
     /// @param newData The new data to be stored in the node's data attribute.
-    SinglyLinkedListNode(T newData);
+    SinglyLinkedListNode(const T& newData);
+    /// @brief SinglyLinkedListNode parameterized constructor that moves the data into the node.
+    /// @param newData The data to be moved into the node's data attribute.
+    SinglyLinkedListNode(T&& newData);
+    /// @brief SinglyLinkedListNode emplacing constructor: builds the data in place from the constructor arguments of T.
+    /// @param args The arguments forwarded to T's constructor.
+    template <typename... Args>
+    SinglyLinkedListNode(std::in_place_t, Args&&... args);
 		/// @brief SinglyLinkedListNode copy constructor.
 		/// @param other The other SLLNode to copy.
 		SinglyLinkedListNode(const SinglyLinkedListNode& other);
@@ -39,18 +54,73 @@ public:
 		SinglyLinkedListNode* getNext();
 };
 
-/// @brief SinglyLinkedList class: implementation of a singly linked list. Contains a pointer to its head and a counter for the number of nodes.
+/// @brief SinglyLinkedListIterator class: STL-style forward iterator over the nodes of a singly linked list.
+/// @tparam T The type stored in the list.
+/// @tparam V T for a mutable iterator; const T for a read-only one.
+template <typename T, typename V>
+class SinglyLinkedListIterator {
+  private:
+    SinglyLinkedListNode<T>* current;
+
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = V*;
+    using reference = V&;
+
+    /// @brief SinglyLinkedListIterator parameterized constructor.
+    /// @param node The node the iterator points to. nullptr is the end of the list.
+    explicit SinglyLinkedListIterator(SinglyLinkedListNode<T>* node = nullptr);
+    /// @brief Copies an iterator. Also allows converting a mutable iterator into a read-only one.
+    /// @param other The iterator to copy.
+    SinglyLinkedListIterator(const SinglyLinkedListIterator<T, T>& other);
+
+    /// @brief Gets the data of the current node.
+    /// @return A reference to the data.
+    reference operator*() const;
+    /// @brief Accesses the members of the current node's data.
+    /// @return A pointer to the data.
+    pointer operator->() const;
+    /// @brief Moves to the next node.
+    /// @return This iterator, already moved.
+    SinglyLinkedListIterator& operator++();
+    /// @brief Moves to the next node.
+    /// @return A copy of this iterator from before moving.
+    SinglyLinkedListIterator operator++(int);
+    /// @brief Checks if two iterators point to the same node.
+    bool operator==(const SinglyLinkedListIterator& other) const;
+    /// @brief Checks if two iterators point to different nodes.
+    bool operator!=(const SinglyLinkedListIterator& other) const;
+    /// @brief Gets the node the iterator points to.
+    /// @return The current node. nullptr at the end of the list.
+    SinglyLinkedListNode<T>* getNode() const;
+};
+
+/// @brief SinglyLinkedList class: implementation of a singly linked list. Contains pointers to its head and tail and a counter for the number of nodes,
+/// so it works as an O(1) FIFO queue (insertTail + popFront).
 /// @tparam T Template for use of generic data.
 template <typename T>
 class SinglyLinkedList {
 private:
     SinglyLinkedListNode<T>* head;
+    SinglyLinkedListNode<T>* tail;
     int size;
 
-    /// @brief Helper method to swap data between two nodes.
-    void swapData(SinglyLinkedListNode<T>*& a, SinglyLinkedListNode<T>*& b);
+    /// @brief Helper method to link a new node after the tail.
+    /// @param newNode The node to link.
+    void linkTail(SinglyLinkedListNode<T>* newNode);
+
+    /// @brief Helper method to cut a chain of nodes after a number of nodes.
+    /// @param first The first node of the chain.
+    /// @param count How many nodes stay in the first part.
+    /// @return The first node of the rest of the chain (nullptr if there is none).
+    static SinglyLinkedListNode<T>* splitAfter(SinglyLinkedListNode<T>* first, int count);
 
 public:
+    using iterator = SinglyLinkedListIterator<T, T>;
+    using const_iterator = SinglyLinkedListIterator<T, const T>;
+
     /// @brief SinglyLinkedList constructor.
     SinglyLinkedList();
     /// @brief SingyLinkedList copy constructor.
@@ -66,14 +136,28 @@ public:
 		/// @brief SinglyLinkedList move assignment constructor.
 		/// @param other The other SLL to move to this one.
 		/// @return This list with the new data.
-		SinglyLinkedList&& operator=(SinglyLinkedList&& other);
+		SinglyLinkedList& operator=(SinglyLinkedList&& other);
     /// @brief SinglyLinkedList destructor.
     ~SinglyLinkedList();
 
     /// @brief Inserts a new node as the list's head.
     void insertHead(const T& data);
+    /// @brief Inserts a new node as the list's head, moving the data into it instead of copying it.
+    void insertHead(T&& data);
     /// @brief Inserts a new node as the list's tail.
     void insertTail(const T& data);
+    /// @brief Inserts a new node as the list's tail, moving the data into it instead of copying it.
+    void insertTail(T&& data);
+    /// @brief Builds a new head node's data in place, without any temporary.
+    /// @param args The arguments forwarded to T's constructor.
+    /// @return A reference to the new data.
+    template <typename... Args>
+    T& emplaceHead(Args&&... args);
+    /// @brief Builds a new tail node's data in place, without any temporary.
+    /// @param args The arguments forwarded to T's constructor.
+    /// @return A reference to the new data.
+    template <typename... Args>
+    T& emplaceTail(Args&&... args);
     /// @brief Inserts a new node after a node that contains a certain data value.
     void insertAfter(const T& target, const T& data);
     /// @brief Inserts a new node before a node that contains a certain data value.
@@ -85,8 +169,12 @@ public:
 
     /// @brief Deletes the list's head node.
     void deleteHead();
-    /// @brief Deletes the list's tail node.
+    /// @brief Deletes the list's tail node. O(n), since the node before the tail has to be found.
     void deleteTail();
+    /// @brief Removes the list's head node and returns its data by move. O(1).
+    /// @return The data that was in the head.
+    /// @throws std::out_of_range if the list is empty.
+    T popFront();
     /// @brief Deletes the node after a node containing a target value.
     void deleteAfter(const T& target);
     /// @brief Deletes the node before a node containing a target value.
@@ -99,8 +187,8 @@ public:
     /// @brief Finds and returns the list's head.
     /// @return A pointer to the list's head.
     SinglyLinkedListNode<T>* getHead();
-    /// @brief Finds and returns the list's tail.
-    /// @return A pointer to the list's tail.
+    /// @brief Returns the list's tail. O(1).
+    /// @return A pointer to the list's tail. nullptr if the list is empty.
     SinglyLinkedListNode<T>* getTail();
     /// @brief Finds and returns the node found at the position specified (uses 1-indexing).
     /// @param position The position of the node to search.
@@ -108,16 +196,37 @@ public:
     SinglyLinkedListNode<T>* getAt(const int position);
     /// @brief Gets the list's size.
     /// @return The list's size.
-    int getSize();
+    int getSize() const;
+
+    /// @brief Gets an iterator to the head. Allows range-based for loops over the list in O(n).
+    /// @return An iterator to the first node.
+    iterator begin();
+    /// @brief Gets the iterator past the last node.
+    /// @return The end iterator.
+    iterator end();
+    /// @brief Gets a read-only iterator to the head.
+    /// @return A read-only iterator to the first node.
+    const_iterator begin() const;
+    /// @brief Gets the read-only iterator past the last node.
+    /// @return The read-only end iterator.
+    const_iterator end() const;
     
     /// @brief Searches for a node with a specific value.
     SinglyLinkedListNode<T>* search(const T& target) const;
-    /// @brief Sorts the list using bubble sort.
+    /// @brief Sorts the list from smallest to biggest (using operator>) with a stable merge sort. O(n log n); relinks nodes without copying data.
     void sort();
+    /// @brief Sorts the list with a stable, iterative merge sort that relinks nodes instead of copying data. O(n log n) time, O(1) extra space.
+    /// @tparam Compare Callable with signature bool(const T& a, const T& b).
+    /// @param compare Returns true if a must go strictly before b. Elements that compare equal keep their relative order.
+    template <typename Compare>
+    void sortBy(Compare compare);
     /// @brief Prints all nodes in the list.
     void print() const;
     /// @brief Clears the list.
     void clear();
+    /// @brief Moves every node of another list to the end of this one in O(1), without copying data. The other list is left empty.
+    /// @param other The list whose nodes are moved.
+    void splice(SinglyLinkedList<T>& other);
 
     /// @brief Overload of comparison operator == to check if two SLLs are the same (their nodes' data and pointers are the same).
     /// @param other The other list to compare with.
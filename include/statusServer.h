@@ -0,0 +1,103 @@
+#pragma once
+
+#include <atomic>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <seqlock.hxx>
+
+/// @brief Resumen de un histograma de latencias, en microsegundos.
+struct StatusLatency {
+  unsigned long long count;
+  double mean;
+  unsigned long long p50;
+  unsigned long long p90;
+  unsigned long long p99;
+  unsigned long long max;
+};
+
+/// @brief Foto del estado del planificador. Es de tamaño fijo (sin std::string) para poder publicarla con un seqlock.
+struct StatusSnapshot {
+  unsigned long long quantums;  // fotos publicadas hasta esta, una por quantum
+  double time;                  // segundos del reloj del planificador
+  bool finished;                // la corrida ya termino
+  char policy[32];
+  char current[64];             // proceso despachado; vacio si no hay
+  int ready;
+  int blocked;
+  int finishedProcesses;
+  int cpuCount;
+  int switchCount;
+  double switchOverhead;
+  int migrations;
+  int deadlineCount;
+  int deadlineMisses;
+  StatusLatency waiting;
+  StatusLatency response;
+  StatusLatency blockedTime;
+  StatusLatency lateness;
+};
+
+/// @brief Servidor local del estado de una corrida: un hilo atiende un socket de dominio UNIX y responde a cada conexion
+/// con la ultima foto del planificador como JSON (HTTP/1.0, para que sirva `curl --unix-socket`).
+/// El planificador publica la foto en un seqlock una vez por quantum: publicar no hace llamadas al sistema ni espera al hilo,
+/// asi que un cliente lento nunca detiene la planificacion. Solo esta disponible en Linux/UNIX.
+class StatusServer {
+  private:
+    std::string path;
+    Seqlock<StatusSnapshot>* board;
+    int listenFd;
+    std::thread* thread;
+    std::atomic<bool> running;
+    std::atomic<unsigned long long> served;
+    /// @brief Dispositivo e inodo del socket que creo start(), para que stop() no borre un archivo que ya no es suyo
+    unsigned long long socketDevice;
+    unsigned long long socketInode;
+
+    /// @brief Ciclo del hilo: espera conexiones y responde cada una con la foto publicada
+    void serve();
+    /// @brief Responde a un cliente y cierra la conexion
+    /// @param clientFd El socket del cliente
+    void answer(int clientFd);
+
+  public:
+    /// @brief Constructor parametrizado
+    /// @param newPath La ruta del socket
+    StatusServer(const std::string& newPath);
+    StatusServer(const StatusServer& other) = delete;
+    StatusServer& operator=(const StatusServer& other) = delete;
+    /// @brief Destructor. Detiene el hilo y borra el socket.
+    ~StatusServer();
+
+    /// @brief Revisa si el servidor se puede usar en esta plataforma.
+    /// @return true si sí; false si no.
+    static bool isSupported();
+    /// @brief Crea el socket y lanza el hilo que lo atiende. Si la ruta ya existe solo la reemplaza si es un socket (p. ej. uno que
+    /// quedo de una corrida anterior); si es cualquier otro archivo no lo toca y no arranca.
+    /// @return true si lo logro; false si no (imprime el error)
+    bool start();
+    /// @brief Detiene el hilo y borra el socket, si la ruta sigue siendo el socket que creo start(). No hace nada si no esta corriendo.
+    void stop();
+    /// @brief Publica una foto. La llama solo el planificador; nunca espera.
+    /// @param snapshot La foto
+    void publish(const StatusSnapshot& snapshot);
+    /// @brief Copia la ultima foto publicada.
+    /// @return La foto
+    StatusSnapshot getSnapshot() const;
+    /// @brief Getter de la cantidad de conexiones respondidas
+    /// @return La cantidad de conexiones
+    unsigned long long getServedCount() const;
+    /// @brief Getter de la ruta del socket
+    /// @return La ruta
+    const std::string& getPath() const;
+
+    /// @brief Escribe una foto como JSON
+    /// @param os El stream de salida
+    /// @param snapshot La foto
+    static void writeJson(std::ostream& os, const StatusSnapshot& snapshot);
+    /// @brief Cliente: se conecta a un servidor y lee su respuesta completa.
+    /// @param socketPath La ruta del socket
+    /// @param response Donde se deja la respuesta (encabezados HTTP y JSON)
+    /// @return true si lo logro; false si no
+    static bool query(const std::string& socketPath, std::string& response);
+};
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <iostream>
+#include <string>
+
+/// @brief Estado de un proceso en la linea de tiempo.
+enum class TimelineState {
+  NONE,     // todavia no llega o ya termino
+  READY,
+  RUNNING,
+  BLOCKED
+};
+
+/// @brief Intervalo en que un proceso estuvo en un mismo estado.
+struct TimelineInterval {
+  int track;            // linea del proceso
+  int cpu;              // CPU en que corrio (solo para RUNNING)
+  TimelineState state;
+  double start;         // segundos del reloj del planificador
+  double end;
+};
+
+/// @brief Linea de tiempo de una corrida: los intervalos READY, RUNNING y BLOCKED de cada proceso, y por lo tanto lo que corrio en cada CPU.
+/// El planificador solo avisa los cambios de estado, asi que se guarda un intervalo por cambio de contexto y no uno por instruccion:
+/// los intervalos vacios se descartan y uno que sigue a otro del mismo estado (p. ej. despachar de nuevo al proceso que se acaba de cortar) se une con el.
+/// Se exporta como diagrama de Gantt (HTML con un SVG) o como JSON de trace events de Chrome (chrome://tracing, Perfetto).
+class Timeline {
+  private:
+    TimelineInterval* intervals;
+    int intervalCount;
+    int intervalCapacity;
+    /// @brief Nombre de cada linea (proceso)
+    std::string* names;
+    /// @brief Estado abierto de cada linea, desde cuando, en que CPU, y su ultimo intervalo cerrado (-1 si no tiene)
+    TimelineState* openStates;
+    double* openStarts;
+    int* openCpus;
+    int* lastIntervals;
+    int trackCount;
+    int trackCapacity;
+    /// @brief Cantidad de CPUs que aparecen en los intervalos
+    int cpuCount;
+
+    /// @brief Cierra el estado abierto de una linea en un momento dado
+    /// @param track La linea
+    /// @param time El momento
+    void closeTrack(int track, double time);
+
+  public:
+    /// @brief Constructor predeterminado
+    Timeline();
+    Timeline(const Timeline& other) = delete;
+    Timeline& operator=(const Timeline& other) = delete;
+    /// @brief Destructor
+    ~Timeline();
+
+    /// @brief Añade la linea de un proceso
+    /// @param name El nombre del proceso
+    /// @return El indice de la linea
+    int addTrack(const std::string& name);
+    /// @brief Cambia el estado de una linea; cierra el intervalo del estado anterior
+    /// @param track La linea
+    /// @param state El nuevo estado; NONE cuando el proceso termina
+    /// @param time El momento del cambio
+    /// @param cpu El CPU, si el nuevo estado es RUNNING
+    void transition(int track, TimelineState state, double time, int cpu = 0);
+    /// @brief Cierra los intervalos abiertos de todas las lineas, al final de la corrida
+    /// @param time El momento del cierre
+    void close(double time);
+
+    /// @brief Getter de la cantidad de lineas
+    /// @return La cantidad de lineas
+    int getTrackCount() const;
+    /// @brief Getter del nombre de una linea
+    /// @param track La linea
+    /// @return El nombre del proceso
+    const std::string& getTrackName(int track) const;
+    /// @brief Getter de la cantidad de intervalos cerrados
+    /// @return La cantidad de intervalos
+    int getIntervalCount() const;
+    /// @brief Getter de un intervalo cerrado
+    /// @param index El indice del intervalo, en orden de cierre
+    /// @return El intervalo
+    const TimelineInterval& getInterval(int index) const;
+    /// @brief Momento en que termina el ultimo intervalo
+    /// @return Los segundos
+    double getEnd() const;
+
+    /// @brief Escribe un diagrama de Gantt como pagina HTML con un SVG: una fila por CPU con los procesos que corrieron en ella,
+    /// y una fila por proceso con sus estados.
+    /// @param os El stream de salida
+    void writeGantt(std::ostream& os) const;
+    /// @brief Escribe los intervalos como JSON de trace events de Chrome: un hilo por CPU y uno por proceso.
+    /// @param os El stream de salida
+    void writeChromeTrace(std::ostream& os) const;
+    /// @brief Escribe el diagrama de Gantt en un archivo
+    /// @param filename El nombre del archivo
+    /// @return true si lo logro escribir; false si no
+    bool writeGantt(const std::string& filename) const;
+    /// @brief Escribe el JSON de trace events en un archivo
+    /// @param filename El nombre del archivo
+    /// @return true si lo logro escribir; false si no
+    bool writeChromeTrace(const std::string& filename) const;
+};
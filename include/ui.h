@@ -1,5 +1,6 @@
 #pragma once
 
+#include <fstream>
 #include <iostream>
 #include <string>
 #include <scheduler.h>
@@ -9,6 +10,30 @@ class UI {
 	private:
 		std::string filename;
 		Scheduler* scheduler;
+		bool useNativeBackend;
+		int pinnedCpu;
+		bool printProfile;
+		bool usePerfCounters;
+		std::string profileTraceFile;
+		bool virtualTime;
+		bool instructionTrace;
+		bool deterministic;
+		unsigned int seed;
+		std::string eventTraceFile;
+		std::ofstream* eventTraceStream;
+		/// @brief Archivos donde se exporta la linea de tiempo al terminar; vacios si no se pidio
+		std::string ganttFile;
+		std::string timelineTraceFile;
+		/// @brief Costos de un cambio de contexto, en segundos, y si se evitan los cambios entre procesos de igual prioridad
+		double switchCost;
+		double warmupCost;
+		bool stickyEqualPriority;
+		/// @brief Cantidad de CPUs simulados; con mas de uno la simulacion es en tiempo virtual
+		int cpuCount;
+		/// @brief Ruta del socket donde se sirve el estado en vivo; vacia si no se pidio
+		std::string statusSocket;
+		/// @brief Algoritmo escogido por la linea de comandos ("rr", "prioridad", "edf" o "rm"); vacio para preguntarlo
+		std::string policyName;
 
 	public: 
 		/// @brief Constructor predeterminado
@@ -29,9 +54,28 @@ class UI {
 		/// @return scheduler
 		Scheduler* getScheduler();
 
+	  /// @brief Lee las opciones de la linea de comandos
+	  /// @param argc La cantidad de argumentos
+	  /// @param argv Los argumentos
+	  /// @return true si todas las opciones son validas; false si no (imprime el modo de uso)
+	  bool parseArguments(int argc, char* argv[]);
+	  /// @brief Imprime el modo de uso del programa y sus opciones
+	  static void printUsage();
+	  /// @brief Aplica las opciones de la linea de comandos al planificador escogido
+	  void applyOptions();
 	  /// @brief Ejecuta los procesos de input
 	  void run();
+	  /// @brief Muestra los reportes pedidos por la linea de comandos despues de que el planificador termina
+	  void report();
 	  
+	  /// @brief Revisa si un nombre es el de un algoritmo de planificacion
+	  /// @param name El nombre
+	  /// @return true si es "rr", "prioridad", "edf" o "rm"; false si no
+	  static bool isPolicyName(const std::string& name);
+	  /// @brief Crea el planificador de un algoritmo por su nombre
+	  /// @param name "rr", "prioridad", "edf" o "rm"
+	  /// @return El planificador; nullptr si el nombre no es valido
+	  static Scheduler* createScheduler(const std::string& name);
 	  /// @brief Le pide al usuario que escoja uno de los archivos
 	  void askForFileName();
 	  /// @brief Le pide al usuario que escoja uno de los algoritmos de planificacion
@@ -0,0 +1,204 @@
+#include <costModel.h>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+
+static const std::string COST_DIRECTIVE = "costo ";
+static const std::string LATENCY_DIRECTIVE = "latencia ";
+static const std::string DEVICE_DIRECTIVE = "dispositivo ";
+static const std::string DEFAULT_COST_NAME = "predeterminado";
+
+/// @brief Convierte un texto a un numero no negativo.
+/// @return true si todo el texto es un numero valido; false si no
+static bool parseNonNegative(const std::string& text, double& value) {
+  if (text.empty()) {
+    return false;
+  }
+  char* end = nullptr;
+  value = std::strtod(text.c_str(), &end);
+  return *end == '\0' && value >= 0;
+}
+
+CostModel::CostModel() : costs(nullptr), capacity(0), cpuCost(DEFAULT_CPU_COST), devices(nullptr), deviceCount(0), deviceCapacity(0) {
+  setCost(InstructionDictionary::IO, DEFAULT_IO_COST);
+  addDevice({DEFAULT_COST_NAME, DEFAULT_IO_LATENCY, 1, ServiceDistribution::FIXED});
+}
+
+CostModel::CostModel(const CostModel& other) : costs(nullptr), capacity(0), cpuCost(other.cpuCost),
+  devices(nullptr), deviceCount(0), deviceCapacity(0) {
+  *this = other;
+}
+
+CostModel& CostModel::operator=(const CostModel& other) {
+  if (this != &other) {
+    delete[] costs;
+    capacity = other.capacity;
+    costs = capacity > 0 ? new double[capacity] : nullptr;
+    for (int id = 0; id < capacity; id++) {
+      costs[id] = other.costs[id];
+    }
+    cpuCost = other.cpuCost;
+    delete[] devices;
+    deviceCount = other.deviceCount;
+    deviceCapacity = other.deviceCount;
+    devices = deviceCount > 0 ? new DeviceSpec[deviceCount] : nullptr;
+    for (int index = 0; index < deviceCount; index++) {
+      devices[index] = other.devices[index];
+    }
+  }
+  return *this;
+}
+
+CostModel::~CostModel() {
+  delete[] costs;
+  delete[] devices;
+}
+
+void CostModel::reserve(int id) {
+  if (id < capacity) {
+    return;
+  }
+  int newCapacity = capacity == 0 ? 16 : capacity;
+  while (newCapacity <= id) {
+    newCapacity *= 2;
+  }
+  double* newCosts = new double[newCapacity];
+  int index;
+  for (index = 0; index < capacity; index++) {
+    newCosts[index] = costs[index];
+  }
+  for (; index < newCapacity; index++) {
+    newCosts[index] = -1;
+  }
+  delete[] costs;
+  costs = newCosts;
+  capacity = newCapacity;
+}
+
+double CostModel::getDefaultCost(int instructionId) {
+  return instructionId == InstructionDictionary::IO ? DEFAULT_IO_COST : DEFAULT_CPU_COST;
+}
+
+double CostModel::getCost(int instructionId) const {
+  if (instructionId >= 0 && instructionId < capacity && costs[instructionId] >= 0) {
+    return costs[instructionId];
+  }
+  return cpuCost;
+}
+
+void CostModel::setCost(int instructionId, double cost) {
+  reserve(instructionId);
+  costs[instructionId] = cost;
+}
+
+double CostModel::getCPUCost() const {
+  return cpuCost;
+}
+
+void CostModel::setCPUCost(double cost) {
+  cpuCost = cost;
+}
+
+double CostModel::getIOLatency() const {
+  return devices[DEFAULT_DEVICE].latency;
+}
+
+void CostModel::setIOLatency(double latency) {
+  devices[DEFAULT_DEVICE].latency = latency;
+}
+
+int CostModel::getDeviceCount() const {
+  return deviceCount;
+}
+
+const DeviceSpec& CostModel::getDevice(int index) const {
+  return devices[index];
+}
+
+int CostModel::findDevice(const std::string& name) const {
+  for (int index = 0; index < deviceCount; index++) {
+    if (devices[index].name == name) {
+      return index;
+    }
+  }
+  return -1;
+}
+
+int CostModel::addDevice(const DeviceSpec& device) {
+  int index = findDevice(device.name);
+  if (index >= 0) {
+    devices[index] = device;
+    return index;
+  }
+  if (deviceCount == deviceCapacity) {
+    int newCapacity = deviceCapacity == 0 ? 4 : deviceCapacity * 2;
+    DeviceSpec* newDevices = new DeviceSpec[newCapacity];
+    for (int i = 0; i < deviceCount; i++) {
+      newDevices[i] = devices[i];
+    }
+    delete[] devices;
+    devices = newDevices;
+    deviceCapacity = newCapacity;
+  }
+  devices[deviceCount] = device;
+  return deviceCount++;
+}
+
+bool CostModel::isDirective(const std::string& line) {
+  return line.compare(0, COST_DIRECTIVE.size(), COST_DIRECTIVE) == 0
+    || line.compare(0, LATENCY_DIRECTIVE.size(), LATENCY_DIRECTIVE) == 0
+    || line.compare(0, DEVICE_DIRECTIVE.size(), DEVICE_DIRECTIVE) == 0;
+}
+
+bool CostModel::parseDirective(const std::string& line, std::ostream& errors) {
+  double value;
+  if (line.compare(0, LATENCY_DIRECTIVE.size(), LATENCY_DIRECTIVE) == 0) {
+    if (!parseNonNegative(line.substr(LATENCY_DIRECTIVE.size()), value)) {
+      errors << "Latencia invalida: " << line << std::endl;
+      return false;
+    }
+    setIOLatency(value);
+    return true;
+  }
+  if (line.compare(0, DEVICE_DIRECTIVE.size(), DEVICE_DIRECTIVE) == 0) {
+    std::stringstream stream(line.substr(DEVICE_DIRECTIVE.size()));
+    std::string name, latency, parallelism = "1", distribution = "fija", extra;
+    stream >> name >> latency;
+    stream >> parallelism >> distribution >> extra;
+    DeviceSpec device = {name, 0, 0, ServiceDistribution::FIXED};
+    bool valid = !name.empty() && parseNonNegative(latency, device.latency) && extra.empty();
+    double channels = 0;
+    valid = valid && parseNonNegative(parallelism, channels) && channels >= 1 && channels == (int) channels;
+    device.parallelism = (int) channels;
+    if (distribution == "exponencial") {
+      device.distribution = ServiceDistribution::EXPONENTIAL;
+    } else if (distribution == "uniforme") {
+      device.distribution = ServiceDistribution::UNIFORM;
+    } else if (distribution != "fija") {
+      valid = false;
+    }
+    if (!valid) {
+      errors << "Dispositivo invalido: " << line << std::endl;
+      return false;
+    }
+    addDevice(device);
+    return true;
+  }
+  if (line.compare(0, COST_DIRECTIVE.size(), COST_DIRECTIVE) == 0) {
+    // el texto de la instruccion puede tener espacios ("instruccion 3"); el costo es la ultima palabra
+    size_t lastSpace = line.find_last_of(' ');
+    std::string instruction = lastSpace > COST_DIRECTIVE.size() ? line.substr(COST_DIRECTIVE.size(), lastSpace - COST_DIRECTIVE.size()) : "";
+    if (instruction.empty() || !parseNonNegative(line.substr(lastSpace + 1), value)) {
+      errors << "Costo invalido: " << line << std::endl;
+      return false;
+    }
+    if (instruction == DEFAULT_COST_NAME) {
+      cpuCost = value;
+    } else {
+      setCost(InstructionDictionary::intern(instruction), value);
+    }
+    return true;
+  }
+  errors << "Directiva desconocida: " << line << std::endl;
+  return false;
+}
@@ -1,15 +1,28 @@
 #include <fileParser.h>
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <climits>
+#include <cstdlib>
+#include <exception>
+#include <functional>
+#include <thread>
 
-FileParser::FileParser() : filename("null"){
+FileParser::FileParser() : filename("null"), lineCount(0), errorCount(0), warningCount(0), discardedCount(0) {
   processes = new SinglyLinkedList<Process>();
+  costModel = new CostModel();
+  diagnostics = new SinglyLinkedList<ParseDiagnostic>();
   if (!processes) {
     throw std::runtime_error("Failed to allocate memory for process");
   }
 }
 
-FileParser::FileParser(const std::string inputFile) : filename(inputFile){
+FileParser::FileParser(const std::string inputFile) : filename(inputFile), lineCount(0), errorCount(0), warningCount(0),
+  discardedCount(0) {
   std::ifstream archivo;
   processes = new SinglyLinkedList<Process>();
+  costModel = new CostModel();
+  diagnostics = new SinglyLinkedList<ParseDiagnostic>();
   if (!processes) {
     throw std::runtime_error("Failed to allocate memory for process");
   }
@@ -17,6 +30,214 @@ FileParser::FileParser(const std::string inputFile) : filename(inputFile){
 
 FileParser::~FileParser() {
   delete processes;
+  delete costModel;
+  delete diagnostics;
+}
+
+// cache por hilo de los ultimos textos internados: los archivos grandes repiten pocas instrucciones distintas,
+// asi que casi nunca se toma el mutex del diccionario (que los hilos de parseFileParallel comparten)
+static int internCached(const std::string& text) {
+	static const int CACHE_SIZE = 64;
+	static thread_local std::string texts[CACHE_SIZE];
+	static thread_local int ids[CACHE_SIZE] = {0};
+	int index = static_cast<int>(std::hash<std::string>()(text) % CACHE_SIZE);
+	if (ids[index] == 0 || texts[index] != text) {
+		texts[index] = text;
+		ids[index] = InstructionDictionary::intern(text) + 1;
+	}
+	return ids[index] - 1;
+}
+
+// un encabezado que abre un proceso sin importar si hay otro abierto: ahi se puede empezar a leer a la mitad del archivo
+static bool isShardBoundary(const std::string& linea) {
+	return linea.find("proceso") != std::string::npos && linea.find("fin proceso") == std::string::npos
+		&& linea.compare(0, 8, "comando ") != 0 && !CostModel::isDirective(linea);
+}
+
+// prioridad entera, sin nada mas que espacios despues (el "\r" de los archivos de Windows incluido); a diferencia de stoi, no lanza
+static bool parsePriority(const std::string& texto, int& prioridad) {
+	const char* inicio = texto.c_str();
+	char* fin = nullptr;
+	errno = 0;
+	long valor = std::strtol(inicio, &fin, 10);
+	if (fin == inicio || errno == ERANGE || valor < INT_MIN || valor > INT_MAX) {
+		return false;
+	}
+	for (; *fin; fin++) {
+		if (!std::isspace((unsigned char) *fin)) {
+			return false;
+		}
+	}
+	prioridad = (int) valor;
+	return true;
+}
+
+static bool isBlank(const std::string& linea) {
+	for (char caracter : linea) {
+		if (!std::isspace((unsigned char) caracter)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void FileParser::ParseState::report(long long numero, bool error, const std::string& mensaje) {
+	if (error) {
+		errores++;
+	} else {
+		advertencias++;
+	}
+	if (diagnosticos.getSize() < MAX_DIAGNOSTICS) {
+		diagnosticos.insertTail(ParseDiagnostic{numero, error, mensaje});
+	}
+}
+
+void FileParser::finish(ParseState& estado) {
+	if (estado.nuevoProceso) {
+		estado.report(estado.lineaProceso, true, "el proceso " + estado.nuevoProceso->getName() + " no tiene \"fin proceso\"; se descarta");
+		estado.descartados++;
+		delete estado.nuevoProceso;
+		estado.nuevoProceso = nullptr;
+	}
+	estado.descartando = false;
+}
+
+void FileParser::collect(ParseState& estado, long long desplazamiento) {
+	for (ParseDiagnostic& diagnostico : estado.diagnosticos) {
+		if (diagnostics->getSize() >= MAX_DIAGNOSTICS) {
+			break;
+		}
+		diagnostico.line += desplazamiento;
+		diagnostics->insertTail(std::move(diagnostico));
+	}
+	estado.diagnosticos.clear();
+	lineCount += estado.linea;
+	errorCount += estado.errores;
+	warningCount += estado.advertencias;
+	discardedCount += estado.descartados;
+}
+
+bool FileParser::parseLine(const std::string& linea, ParseState& estado, SinglyLinkedList<Process>& destino, bool aplicarDirectivas) {
+	char delimitador = ' ';
+	Process*& nuevoProceso = estado.nuevoProceso;
+	long long numero = ++estado.linea;
+	// la linea ya viene sin el salto de linea; no hace falta copiarla a otro stream
+	const std::string& instrucciones = linea;
+
+	static const std::string encontrar1 = "proceso";
+	static const std::string encontrar2 = "fin proceso";
+	static const std::string encontrar3 = "comando ";
+	static const std::string encontrar4 = "e/s ";
+	size_t pos1 = instrucciones.find(encontrar1);
+	size_t pos2 = instrucciones.find(encontrar2);
+
+	// el proceso de un encabezado invalido se salta entero, hasta su "fin proceso" o hasta el siguiente encabezado
+	if (estado.descartando) {
+		if (pos2 != std::string::npos) {
+			estado.descartando = false;
+			return true;
+		}
+		if (pos1 == std::string::npos || instrucciones.compare(0, encontrar3.size(), encontrar3) == 0) {
+			return true;
+		}
+		estado.descartando = false;
+	}
+
+	// comando real del proceso (backend nativo); se revisa primero porque el comando puede contener cualquier texto
+	if (nuevoProceso && instrucciones.compare(0, encontrar3.size(), encontrar3) == 0) {
+		nuevoProceso->setCommand(instrucciones.substr(encontrar3.size()));
+	// encabezado de costos, fuera de los bloques de proceso
+	} else if (!nuevoProceso && CostModel::isDirective(instrucciones)) {
+		if (!aplicarDirectivas) {
+			return false;
+		}
+		std::stringstream error;
+		if (!costModel->parseDirective(instrucciones, error)) {
+			std::string mensaje = error.str();
+			estado.report(numero, false, mensaje.substr(0, mensaje.find('\n')));
+		}
+	// si llega al final del proceso
+	} else if (pos2 != std::string::npos) {
+		if (nuevoProceso) {
+			destino.insertHead(std::move(*nuevoProceso));
+			delete nuevoProceso;
+			nuevoProceso = nullptr;
+		} else {
+			estado.report(numero, false, "\"fin proceso\" sin un proceso abierto; se ignora");
+		}
+	// si llega al encabezado
+	} else if (pos1 != std::string::npos) {
+		std::stringstream stream1(linea);
+		std::string proceso, nombrePrograma, numPrioridad;
+		getline(stream1, proceso, delimitador);
+		getline(stream1, nombrePrograma, delimitador);
+		getline(stream1, numPrioridad, delimitador);
+
+		// un encabezado con otro proceso abierto descarta el anterior, que no se cerro
+		finish(estado);
+		estado.lineaProceso = numero;
+		int priority = 0;
+		if (nombrePrograma.empty()) {
+			estado.report(numero, true, "encabezado sin nombre de proceso; se descarta el proceso");
+		} else if (!parsePriority(numPrioridad, priority)) {
+			estado.report(numero, true, "prioridad invalida en el encabezado de " + nombrePrograma + ": \"" + numPrioridad + "\"; se descarta el proceso");
+		} else {
+			nuevoProceso = new Process(nombrePrograma, priority);
+		}
+		if (!nuevoProceso) {
+			estado.descartando = true;
+			estado.descartados++;
+			return true;
+		}
+		// campos opcionales: "plazo <segundos>", "periodo <segundos>", "grupo <nombre>" y "afinidad <cpu>"
+		std::string campo;
+		while (stream1 >> campo) {
+			std::string texto;
+			double valor = 0;
+			bool valido = static_cast<bool>(stream1 >> texto);
+			if (valido && campo != "grupo") {
+				std::stringstream numero(texto);
+				valido = (numero >> valor) && numero.eof() && (campo == "afinidad" ? valor >= 0 && valor == (int) valor : valor > 0);
+			}
+			if (!valido || (campo != "plazo" && campo != "periodo" && campo != "grupo" && campo != "afinidad")) {
+				estado.report(numero, false, "campo invalido en el encabezado de " + nombrePrograma + ": " + campo + "; se ignora el resto");
+				break;
+			}
+			if (campo == "plazo") {
+				nuevoProceso->setDeadline(valor);
+			} else if (campo == "periodo") {
+				nuevoProceso->setPeriod(valor);
+			} else if (campo == "grupo") {
+				nuevoProceso->setGroup(texto);
+			} else {
+				nuevoProceso->setAffinity((int) valor);
+			}
+		}
+	// instrucciones del proceso
+	// E/S en un dispositivo en particular: es la misma instruccion "e/s", con el dispositivo resuelto aqui
+	} else if (nuevoProceso && instrucciones.compare(0, encontrar4.size(), encontrar4) == 0) {
+		std::string dispositivo = instrucciones.substr(encontrar4.size());
+		int device = costModel->findDevice(dispositivo);
+		if (device < 0) {
+			estado.report(numero, false, "dispositivo desconocido: " + dispositivo + "; se usa el predeterminado");
+			device = CostModel::DEFAULT_DEVICE;
+		}
+		nuevoProceso->addInstruction(InstructionDictionary::IO, costModel->getCost(InstructionDictionary::IO), device);
+	} else if (nuevoProceso) {
+		// introducir instrucción al proceso correspondiente; el texto se guarda una sola vez en el diccionario y el costo se resuelve aqui
+		int instructionId = internCached(instrucciones);
+		nuevoProceso->addInstruction(instructionId, costModel->getCost(instructionId));
+	} else if (!isBlank(instrucciones)) {
+		estado.report(numero, false, "linea fuera de un proceso; se ignora");
+	}
+	return true;
+}
+
+void FileParser::parseLines(std::istream& archivo, ParseState& estado) {
+	std::string linea;
+	while (getline(archivo, linea)) {
+		parseLine(linea, estado, *processes, true);
+	}
 }
 
 bool FileParser::parseFile(std::string filename) {
@@ -28,52 +249,193 @@ bool FileParser::parseFile(std::string filename) {
     return false;
   } 
 
+	this->filename = filename;
+	ParseState estado;
+	parseLines(archivo, estado);
+	finish(estado);
+	collect(estado, 0);
+
+  archivo.close();
+  return true;
+}
+
+bool FileParser::parseShard(const std::string& filename, long long inicio, long long fin, SinglyLinkedList<Process>& destino, ParseState& estado) {
+	std::ifstream archivo(filename, std::ios::in | std::ios::binary);
 	std::string linea;
-	char delimitador = ' ';
-	Process* nuevoProceso = nullptr;
+	long long posicion = inicio;
+	if (inicio > 0) {
+		// se descarta el resto de la linea en que cae el inicio, salvo que el inicio sea justo el comienzo de una linea
+		archivo.seekg(inicio - 1);
+		getline(archivo, linea);
+		posicion = inicio - 1 + (long long) linea.size() + 1;
+	} else {
+		archivo.seekg(0);
+	}
+	bool empezo = false;
+	bool sinDirectivas = true;
+	while (getline(archivo, linea)) {
+		long long comienzo = posicion;
+		posicion += (long long) linea.size() + 1;
+		if (isShardBoundary(linea)) {
+			if (comienzo >= fin) {
+				break;
+			}
+			empezo = true;
+		}
+		if (empezo && !parseLine(linea, estado, destino, false)) {
+			sinDirectivas = false;
+		}
+	}
+	// el siguiente encabezado (en el otro pedazo) descarta el proceso abierto, igual que en parseFile
+	finish(estado);
+	return sinDirectivas;
+}
+
+bool FileParser::parseFileParallel(const std::string filename, int threadCount) {
+	std::ifstream archivo;
+	archivo.open(filename, std::ios::in | std::ios::binary);
+	if (!archivo.is_open()) {
+		std::cerr << "Error al abrir el archivo" << std::endl;
+		return false;
+	}
 
-	while (getline(archivo, linea)) {  
-		std::stringstream stream(linea);
-		std::string instrucciones;
-		getline(stream, instrucciones);
+	// el encabezado de costos (y cualquier cosa antes del primer proceso) se lee en este hilo
+	this->filename = filename;
+	std::string linea;
+	ParseState encabezado;
+	long long primerProceso = 0;
+	bool hayProcesos = false;
+	while (getline(archivo, linea)) {
+		if (isShardBoundary(linea)) {
+			hayProcesos = true;
+			break;
+		}
+		parseLine(linea, encabezado, *processes, true);
+		primerProceso += (long long) linea.size() + 1;
+	}
+	// el primer encabezado deja sin cerrar cualquier proceso abierto, como en parseFile
+	finish(encabezado);
+	long long lineasEncabezado = encabezado.linea;
+	collect(encabezado, 0);
+	archivo.clear();
+	archivo.seekg(0, std::ios::end);
+	long long tamano = archivo.tellg();
 
-		std::string encontrar1 = "proceso";
-		std::string encontrar2 = "fin proceso";
-		size_t pos1 = instrucciones.find(encontrar1);
-		size_t pos2 = instrucciones.find(encontrar2);
+	int shardCount = threadCount;
+	if (shardCount <= 0) {
+		shardCount = std::max(1u, std::thread::hardware_concurrency());
+		shardCount = (int) std::min((long long) shardCount, (tamano - primerProceso) / MIN_SHARD_SIZE + 1);
+	}
+	if (!hayProcesos || shardCount <= 1) {
+		ParseState estado;
+		archivo.seekg(primerProceso);
+		parseLines(archivo, estado);
+		finish(estado);
+		collect(estado, lineasEncabezado);
+		return true;
+	}
 
-		// si llega al final del proceso
-		if (pos2 != std::string::npos) {
-			if (nuevoProceso) {
-				processes->insertHead(*nuevoProceso);
-				delete nuevoProceso;
-				nuevoProceso = nullptr;
+	SinglyLinkedList<Process>* shards = new SinglyLinkedList<Process>[shardCount];
+	ParseState* estados = new ParseState[shardCount];
+	bool* sinDirectivas = new bool[shardCount];
+	std::exception_ptr* errores = new std::exception_ptr[shardCount];
+	std::thread* hilos = new std::thread[shardCount];
+	for (int shard = 0; shard < shardCount; shard++) {
+		long long inicio = primerProceso + (tamano - primerProceso) * shard / shardCount;
+		long long fin = primerProceso + (tamano - primerProceso) * (shard + 1) / shardCount;
+		hilos[shard] = std::thread([this, &filename, inicio, fin, shards, estados, sinDirectivas, errores, shard]() {
+			try {
+				sinDirectivas[shard] = parseShard(filename, inicio, fin, shards[shard], estados[shard]);
+			} catch (...) {
+				errores[shard] = std::current_exception();
 			}
-		// si llega al encabezado
-		} else if (pos1 != std::string::npos) {
-			std::stringstream stream1(linea);
-			std::string proceso, nombrePrograma, numPrioridad;
-			getline(stream1, proceso, delimitador);
-			getline(stream1, nombrePrograma, delimitador);
-			getline(stream1, numPrioridad, delimitador);
-
-			// Pasar nombrePrograma, int numPrioridad
-			int priority = stoi(numPrioridad);
-			nuevoProceso = new Process(nombrePrograma, priority);
-		// instrucciones del proceso
-		} else {
-			// introducir instrucción a la lista del proceso correspondiente
-			nuevoProceso->addInstruction(instrucciones);
-		}
+		});
 	}
-	if (nuevoProceso) {
-		delete nuevoProceso;	
+	bool paralelo = true;
+	std::exception_ptr error = nullptr;
+	for (int shard = 0; shard < shardCount; shard++) {
+		hilos[shard].join();
+		if (!error && errores[shard]) {
+			error = errores[shard];
+		}
+		paralelo = paralelo && (errores[shard] || sinDirectivas[shard]);
 	}
 
-  archivo.close();
-  return true;
+	// cada pedazo tiene sus procesos en orden inverso, asi que el ultimo pedazo va primero, igual que con insertHead
+	if (!error && paralelo) {
+		SinglyLinkedList<Process> unidos;
+		for (int shard = shardCount - 1; shard >= 0; shard--) {
+			unidos.splice(shards[shard]);
+		}
+		unidos.splice(*processes);
+		*processes = std::move(unidos);
+		// cada pedazo empieza en la linea siguiente a la ultima que leyo el anterior
+		long long desplazamiento = lineasEncabezado;
+		for (int shard = 0; shard < shardCount; shard++) {
+			long long lineas = estados[shard].linea;
+			collect(estados[shard], desplazamiento);
+			desplazamiento += lineas;
+		}
+	}
+	delete[] hilos;
+	delete[] errores;
+	delete[] sinDirectivas;
+	delete[] estados;
+	delete[] shards;
+	if (error) {
+		std::rethrow_exception(error);
+	}
+	if (!paralelo) {
+		// una directiva entre procesos cambia el costo de los que siguen: el resto se lee en orden
+		ParseState estado;
+		archivo.seekg(primerProceso);
+		parseLines(archivo, estado);
+		finish(estado);
+		collect(estado, lineasEncabezado);
+	}
+	return true;
 }
 
 SinglyLinkedList<Process>* FileParser::getProcesses() {
   return processes;
-}
\ No newline at end of file
+}
+
+const CostModel& FileParser::getCostModel() const {
+  return *costModel;
+}
+const SinglyLinkedList<ParseDiagnostic>& FileParser::getDiagnostics() const {
+  return *diagnostics;
+}
+
+int FileParser::getErrorCount() const {
+  return errorCount;
+}
+
+int FileParser::getWarningCount() const {
+  return warningCount;
+}
+
+int FileParser::getDiscardedCount() const {
+  return discardedCount;
+}
+
+long long FileParser::getLineCount() const {
+  return lineCount;
+}
+
+void FileParser::printDiagnostics(std::ostream& os, int limit) const {
+  os << filename << ": " << lineCount << " lineas, " << processes->getSize() << " procesos, " << errorCount << " errores, "
+    << warningCount << " advertencias, " << discardedCount << " procesos descartados" << std::endl;
+  int printed = 0;
+  for (const ParseDiagnostic& diagnostic : *diagnostics) {
+    if (printed == limit) {
+      break;
+    }
+    os << "  linea " << diagnostic.line << ": " << (diagnostic.error ? "error: " : "advertencia: ") << diagnostic.message << std::endl;
+    printed++;
+  }
+  int remaining = errorCount + warningCount - printed;
+  if (remaining > 0) {
+    os << "  (" << remaining << " diagnosticos mas)" << std::endl;
+  }
+}
@@ -0,0 +1,123 @@
+#include <instructionDictionary.h>
+#include <atomic>
+#include <functional>
+#include <mutex>
+
+namespace {
+
+/// @brief Estado del diccionario. Se crea en el primer uso para no depender del orden de inicializacion de otros archivos.
+struct DictionaryState {
+  // directorio de bloques; al llenarse se reemplaza por uno del doble de tamaño y el viejo se retira, porque un lector puede seguir usandolo
+  std::atomic<std::string**> chunks;
+  int chunkCapacity;
+  std::string** retired[32];
+  int retiredCount;
+  std::atomic<int> size;
+
+  // tabla hash de direccionamiento abierto texto -> ID; solo se usa con el mutex tomado
+  std::mutex mutex;
+  int* table;
+  int tableCapacity;
+
+  DictionaryState() : chunkCapacity(16), retiredCount(0), size(0), table(nullptr), tableCapacity(0) {
+    chunks.store(new std::string*[chunkCapacity](), std::memory_order_relaxed);
+    resize(64);
+    append("e/s");
+  }
+
+  ~DictionaryState() {
+    std::string** directory = chunks.load(std::memory_order_relaxed);
+    for (int i = 0; i < chunkCapacity; i++) {
+      delete[] directory[i];
+    }
+    delete[] directory;
+    for (int i = 0; i < retiredCount; i++) {
+      delete[] retired[i];
+    }
+    delete[] table;
+  }
+
+  const std::string& text(int id) const {
+    return chunks.load(std::memory_order_acquire)[id / InstructionDictionary::CHUNK_SIZE][id % InstructionDictionary::CHUNK_SIZE];
+  }
+
+  /// @brief Busca la casilla de la tabla del texto, o la casilla vacia donde iria.
+  int slot(const std::string& value) const {
+    int mask = tableCapacity - 1;
+    int index = static_cast<int>(std::hash<std::string>()(value)) & mask;
+    while (table[index] != -1 && text(table[index]) != value) {
+      index = (index + 1) & mask;
+    }
+    return index;
+  }
+
+  void resize(int newCapacity) {
+    int* oldTable = table;
+    int oldCapacity = tableCapacity;
+    table = new int[newCapacity];
+    tableCapacity = newCapacity;
+    for (int i = 0; i < newCapacity; i++) {
+      table[i] = -1;
+    }
+    for (int i = 0; i < oldCapacity; i++) {
+      if (oldTable[i] != -1) {
+        table[slot(text(oldTable[i]))] = oldTable[i];
+      }
+    }
+    delete[] oldTable;
+  }
+
+  int append(const std::string& value) {
+    int id = size.load(std::memory_order_relaxed);
+    int chunk = id / InstructionDictionary::CHUNK_SIZE;
+    std::string** directory = chunks.load(std::memory_order_relaxed);
+    if (chunk >= chunkCapacity) {
+      // los bloques no se mueven: el directorio nuevo apunta a los mismos. Bastan 17 duplicaciones para cubrir todos los IDs int
+      std::string** grown = new std::string*[chunkCapacity * 2]();
+      for (int i = 0; i < chunkCapacity; i++) {
+        grown[i] = directory[i];
+      }
+      retired[retiredCount++] = directory;
+      chunkCapacity *= 2;
+      directory = grown;
+      chunks.store(directory, std::memory_order_release);
+    }
+    if (!directory[chunk]) {
+      directory[chunk] = new std::string[InstructionDictionary::CHUNK_SIZE];
+    }
+    std::string* storage = directory[chunk];
+    storage[id % InstructionDictionary::CHUNK_SIZE] = value;
+    // se publica despues de escribir el texto: quien vea el nuevo tamaño ve el texto completo
+    size.store(id + 1, std::memory_order_release);
+    if ((id + 1) * 2 > tableCapacity) {
+      resize(tableCapacity * 2);
+    }
+    table[slot(value)] = id;
+    return id;
+  }
+};
+
+DictionaryState& state() {
+  static DictionaryState dictionary;
+  return dictionary;
+}
+
+}
+
+int InstructionDictionary::intern(const std::string& text) {
+  DictionaryState& dictionary = state();
+  std::lock_guard<std::mutex> lock(dictionary.mutex);
+  int index = dictionary.slot(text);
+  if (dictionary.table[index] != -1) {
+    return dictionary.table[index];
+  }
+  return dictionary.append(text);
+}
+
+const std::string& InstructionDictionary::getText(int id) {
+  return state().text(id);
+}
+
+int InstructionDictionary::getSize() {
+  return state().size.load(std::memory_order_acquire);
+}
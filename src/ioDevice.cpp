@@ -0,0 +1,135 @@
+#include <ioDevice.h>
+#include <algorithm>
+
+// los histogramas guardan microsegundos
+static unsigned long long toMicroseconds(double seconds) {
+	return seconds > 0 ? (unsigned long long) (seconds * 1e6 + 0.5) : 0;
+}
+
+IODevice::IODevice(const DeviceSpec& newSpec, unsigned int seed) : spec(newSpec), busyTime(0), completed(0) {
+	reseed(seed);
+	waiting = new SinglyLinkedList<Process>();
+	serving = new SinglyLinkedList<Process>();
+	queueingHistogram = new LatencyHistogram();
+}
+
+IODevice::~IODevice() {
+	delete waiting;
+	waiting = nullptr;
+	delete serving;
+	serving = nullptr;
+	delete queueingHistogram;
+	queueingHistogram = nullptr;
+}
+
+void IODevice::reseed(unsigned int seed) {
+	// FNV-1a del nombre: a diferencia de std::hash, da lo mismo en cualquier plataforma
+	unsigned int hash = 2166136261u;
+	for (char character : spec.name) {
+		hash = (hash ^ (unsigned char) character) * 16777619u;
+	}
+	generator.seed(seed ^ hash);
+}
+
+double IODevice::sampleServiceTime() {
+	switch (spec.distribution) {
+		case ServiceDistribution::EXPONENTIAL:
+			return spec.latency > 0 ? std::exponential_distribution<double>(1 / spec.latency)(generator) : 0;
+		case ServiceDistribution::UNIFORM:
+			return std::uniform_real_distribution<double>(0, 2 * spec.latency)(generator);
+		default:
+			return spec.latency;
+	}
+}
+
+void IODevice::startWaiting(double now) {
+	while (waiting->getSize() > 0 && serving->getSize() < spec.parallelism) {
+		Process process = waiting->popFront();
+		ProcessTimes& times = process.getTimes();
+		// con varios CPUs el planificador puede revisar el dispositivo en un momento anterior al bloqueo (otro CPU de la misma ronda)
+		double start = std::max(now, times.blockedSince);
+		queueingHistogram->record(toMicroseconds(start - times.blockedSince));
+		times.ioStart = start;
+		times.ioDone = start + sampleServiceTime();
+		serving->insertTail(std::move(process));
+	}
+}
+
+void IODevice::enqueue(const Process& process, double now) {
+	waiting->insertTail(process);
+	startWaiting(now);
+}
+
+Process* IODevice::nextCompleted(double now) {
+	startWaiting(now);
+	for (Process& process : *serving) {
+		if (process.getTimes().ioDone <= now) {
+			return &process;
+		}
+	}
+	return nullptr;
+}
+
+bool IODevice::remove(const Process& process, double now) {
+	for (const Process& served : *serving) {
+		if (served == process) {
+			const ProcessTimes& times = served.getTimes();
+			busyTime += std::min(now, times.ioDone) - times.ioStart;
+			if (times.ioDone <= now) {
+				completed++;
+			}
+			serving->deleteByValue(process);
+			startWaiting(now);
+			return true;
+		}
+	}
+	for (const Process& queued : *waiting) {
+		if (queued == process) {
+			waiting->deleteByValue(process);
+			return true;
+		}
+	}
+	return false;
+}
+
+Process* IODevice::peek() {
+	Process* first = nullptr;
+	for (Process& process : *serving) {
+		if (!first || process.getTimes().ioDone < first->getTimes().ioDone) {
+			first = &process;
+		}
+	}
+	if (!first && waiting->getHead()) {
+		first = waiting->getHead()->getPData();
+	}
+	return first;
+}
+
+const DeviceSpec& IODevice::getSpec() const {
+	return spec;
+}
+
+int IODevice::getSize() const {
+	return waiting->getSize() + serving->getSize();
+}
+
+int IODevice::getCompleted() const {
+	return completed;
+}
+
+double IODevice::getUtilization(double elapsed) const {
+	if (elapsed <= 0) {
+		return 0;
+	}
+	return std::min(1.0, busyTime / (elapsed * spec.parallelism));
+}
+
+const LatencyHistogram& IODevice::getQueueingHistogram() const {
+	return *queueingHistogram;
+}
+
+void IODevice::printReport(std::ostream& os, double elapsed) const {
+	os << spec.name << ": " << completed << " operaciones, utilizacion " << getUtilization(elapsed) * 100 << "%"
+		<< " (" << spec.parallelism << (spec.parallelism == 1 ? " canal" : " canales") << ")" << std::endl;
+	queueingHistogram->print(os, "  Espera en cola", 1e6, "s");
+}
@@ -0,0 +1,128 @@
+#include <latencyHistogram.h>
+#include <cstring>
+
+LatencyHistogram::LatencyHistogram() {
+  reset();
+}
+
+int LatencyHistogram::bucketIndex(unsigned long long value) {
+  if (value < (unsigned long long) SUB_BUCKET_COUNT) {
+    return (int) value;
+  }
+  // se conservan los SUB_BUCKET_BITS bits mas significativos del valor
+  int highestBit = 63 - __builtin_clzll(value);
+  int shift = highestBit - (SUB_BUCKET_BITS - 1);
+  if (shift > MAX_SHIFT) {
+    return BUCKET_COUNT - 1;
+  }
+  return SUB_BUCKET_COUNT + (shift - 1) * SUB_BUCKET_HALF + (int) ((value >> shift) - SUB_BUCKET_HALF);
+}
+
+unsigned long long LatencyHistogram::bucketLowest(int index) {
+  if (index < SUB_BUCKET_COUNT) {
+    return index;
+  }
+  int shift = (index - SUB_BUCKET_COUNT) / SUB_BUCKET_HALF + 1;
+  unsigned long long subBucket = (index - SUB_BUCKET_COUNT) % SUB_BUCKET_HALF + SUB_BUCKET_HALF;
+  return subBucket << shift;
+}
+
+unsigned long long LatencyHistogram::bucketHighest(int index) {
+  if (index < SUB_BUCKET_COUNT) {
+    return index;
+  }
+  int shift = (index - SUB_BUCKET_COUNT) / SUB_BUCKET_HALF + 1;
+  return bucketLowest(index) + (1ULL << shift) - 1;
+}
+
+void LatencyHistogram::record(unsigned long long value) {
+  counts[bucketIndex(value)]++;
+  if (totalCount == 0 || value < minValue) {
+    minValue = value;
+  }
+  if (value > maxValue) {
+    maxValue = value;
+  }
+  totalCount++;
+  sum += (double) value;
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other) {
+  if (other.totalCount == 0) {
+    return;
+  }
+  for (int i = 0; i < BUCKET_COUNT; i++) {
+    counts[i] += other.counts[i];
+  }
+  if (totalCount == 0 || other.minValue < minValue) {
+    minValue = other.minValue;
+  }
+  if (other.maxValue > maxValue) {
+    maxValue = other.maxValue;
+  }
+  totalCount += other.totalCount;
+  sum += other.sum;
+}
+
+void LatencyHistogram::reset() {
+  std::memset(counts, 0, sizeof(counts));
+  totalCount = 0;
+  minValue = 0;
+  maxValue = 0;
+  sum = 0;
+}
+
+unsigned long long LatencyHistogram::getCount() const {
+  return totalCount;
+}
+
+unsigned long long LatencyHistogram::getMin() const {
+  return minValue;
+}
+
+unsigned long long LatencyHistogram::getMax() const {
+  return maxValue;
+}
+
+double LatencyHistogram::getMean() const {
+  return totalCount == 0 ? 0 : sum / totalCount;
+}
+
+unsigned long long LatencyHistogram::getPercentile(double percentile) const {
+  if (totalCount == 0) {
+    return 0;
+  }
+  if (percentile < 0) {
+    percentile = 0;
+  }
+  if (percentile > 100) {
+    percentile = 100;
+  }
+  // rango del valor buscado, como en HdrHistogram: al menos 1
+  unsigned long long target = (unsigned long long) (percentile / 100.0 * totalCount + 0.5);
+  if (target < 1) {
+    target = 1;
+  }
+  unsigned long long seen = 0;
+  for (int i = 0; i < BUCKET_COUNT; i++) {
+    seen += counts[i];
+    if (seen >= target) {
+      unsigned long long highest = bucketHighest(i);
+      return highest < maxValue ? highest : maxValue;
+    }
+  }
+  return maxValue;
+}
+
+void LatencyHistogram::print(std::ostream& os, const std::string& label, double scale, const std::string& unit) const {
+  os << label << ": n=" << totalCount;
+  if (totalCount > 0) {
+    os << ", promedio " << getMean() / scale << " " << unit
+      << ", p50 " << getPercentile(50) / scale << " " << unit
+      << ", p90 " << getPercentile(90) / scale << " " << unit
+      << ", p99 " << getPercentile(99) / scale << " " << unit
+      << ", p99.9 " << getPercentile(99.9) / scale << " " << unit
+      << ", max " << getMax() / scale << " " << unit;
+  }
+  os << std::endl;
+}
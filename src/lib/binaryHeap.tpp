@@ -0,0 +1,164 @@
+#include <binaryHeap.hxx>
+
+template <typename T>
+bool BinaryHeap<T>::lessThan(const T& a, const T& b) {
+  return a < b;
+}
+
+template <typename T>
+BinaryHeap<T>::BinaryHeap() : elements(nullptr), size(0), capacity(0), before(lessThan) {}
+
+template <typename T>
+BinaryHeap<T>::BinaryHeap(Comparison newBefore) : elements(nullptr), size(0), capacity(0), before(newBefore ? newBefore : lessThan) {}
+
+template <typename T>
+BinaryHeap<T>::BinaryHeap(const BinaryHeap& other) : elements(nullptr), size(0), capacity(0), before(other.before) {
+  *this = other;
+}
+
+template <typename T>
+BinaryHeap<T>& BinaryHeap<T>::operator=(const BinaryHeap& other) {
+  if (this != &other) {
+    delete[] elements;
+    before = other.before;
+    size = other.size;
+    capacity = other.size;
+    elements = capacity > 0 ? new T[capacity] : nullptr;
+    for (int index = 0; index < size; index++) {
+      elements[index] = other.elements[index];
+    }
+  }
+  return *this;
+}
+
+template <typename T>
+BinaryHeap<T>::~BinaryHeap() {
+  delete[] elements;
+}
+
+template <typename T>
+void BinaryHeap<T>::grow() {
+  int newCapacity = capacity == 0 ? 16 : capacity * 2;
+  T* newElements = new T[newCapacity];
+  for (int index = 0; index < size; index++) {
+    newElements[index] = std::move(elements[index]);
+  }
+  delete[] elements;
+  elements = newElements;
+  capacity = newCapacity;
+}
+
+template <typename T>
+void BinaryHeap<T>::siftUp(int index) {
+  while (index > 0) {
+    int parent = (index - 1) / 2;
+    if (!before(elements[index], elements[parent])) {
+      return;
+    }
+    std::swap(elements[index], elements[parent]);
+    index = parent;
+  }
+}
+
+template <typename T>
+void BinaryHeap<T>::siftDown(int index) {
+  while (true) {
+    int first = index;
+    int left = 2 * index + 1;
+    int right = left + 1;
+    if (left < size && before(elements[left], elements[first])) {
+      first = left;
+    }
+    if (right < size && before(elements[right], elements[first])) {
+      first = right;
+    }
+    if (first == index) {
+      return;
+    }
+    std::swap(elements[index], elements[first]);
+    index = first;
+  }
+}
+
+template <typename T>
+void BinaryHeap<T>::push(const T& data) {
+  if (size == capacity) {
+    grow();
+  }
+  elements[size] = data;
+  siftUp(size++);
+}
+
+template <typename T>
+void BinaryHeap<T>::push(T&& data) {
+  if (size == capacity) {
+    grow();
+  }
+  elements[size] = std::move(data);
+  siftUp(size++);
+}
+
+template <typename T>
+T BinaryHeap<T>::pop() {
+  if (size == 0) {
+    throw std::out_of_range("Heap is empty");
+  }
+  T first = std::move(elements[0]);
+  size--;
+  if (size > 0) {
+    elements[0] = std::move(elements[size]);
+    siftDown(0);
+  }
+  return first;
+}
+
+template <typename T>
+T& BinaryHeap<T>::top() {
+  if (size == 0) {
+    throw std::out_of_range("Heap is empty");
+  }
+  return elements[0];
+}
+
+template <typename T>
+bool BinaryHeap<T>::remove(const T& data) {
+  for (int index = 0; index < size; index++) {
+    if (elements[index] == data) {
+      size--;
+      if (index < size) {
+        // the last element takes its place and may have to go either way
+        elements[index] = std::move(elements[size]);
+        siftDown(index);
+        siftUp(index);
+      }
+      return true;
+    }
+  }
+  return false;
+}
+
+template <typename T>
+const T& BinaryHeap<T>::at(int index) const {
+  if (index < 0 || index >= size) {
+    throw std::out_of_range("Heap index out of range");
+  }
+  return elements[index];
+}
+
+template <typename T>
+void BinaryHeap<T>::clear() {
+  delete[] elements;
+  elements = nullptr;
+  size = 0;
+  capacity = 0;
+}
+
+template <typename T>
+int BinaryHeap<T>::getSize() const {
+  return size;
+}
+
+template <typename T>
+bool BinaryHeap<T>::isEmpty() const {
+  return size == 0;
+}
@@ -5,24 +5,32 @@ BinarySearchTreeNode<T>::BinarySearchTreeNode() : data(), left(nullptr), right(n
 
 template <typename T>
 BinarySearchTreeNode<T>::BinarySearchTreeNode(const BinarySearchTreeNode& other) : data(other.data), left(nullptr), right(nullptr) {
-  if (other.left != nullptr) {
-    left = new BinarySearchTreeNode<T>(*other.left);
-  }
-  if (other.right != nullptr) {
-    right = new BinarySearchTreeNode<T>(*other.right);
+  BinarySearchTreeStack<CopyTask> pending;
+  pending.push(CopyTask{&other, this});
+  while (!pending.isEmpty()) {
+    CopyTask task = pending.pop();
+    // the children are built from their data only, so this constructor never calls itself
+    if (task.source->left) {
+      task.copy->left = new BinarySearchTreeNode<T>(task.source->left->data);
+      pending.push(CopyTask{task.source->left, task.copy->left});
+    }
+    if (task.source->right) {
+      task.copy->right = new BinarySearchTreeNode<T>(task.source->right->data);
+      pending.push(CopyTask{task.source->right, task.copy->right});
+    }
   }
 }
 
 template <typename T>
-BinarySearchTreeNode<T>::BinarySearchTreeNode(BinarySearchTreeNode&& other) : data(other.data), left(other.left), right(other.right) {
+BinarySearchTreeNode<T>::BinarySearchTreeNode(BinarySearchTreeNode&& other) : data(std::move(other.data)), left(other.left), right(other.right) {
 	other.left = nullptr;
 	other.right = nullptr;
 }
 
 template <typename T>
 BinarySearchTreeNode<T>& BinarySearchTreeNode<T>::operator=(BinarySearchTreeNode&& other) {
-	if (this != other) {
-		data = other.data;
+	if (this != &other) {
+		data = std::move(other.data);
 		delete left;
 		delete right;
 		left = other.left;
@@ -34,7 +42,14 @@ BinarySearchTreeNode<T>& BinarySearchTreeNode<T>::operator=(BinarySearchTreeNode
 }
 
 template <typename T>
-BinarySearchTreeNode<T>::BinarySearchTreeNode(T newData) : data(newData), left(nullptr), right(nullptr) {}
+BinarySearchTreeNode<T>::BinarySearchTreeNode(const T& newData) : data(newData), left(nullptr), right(nullptr) {}
+
+template <typename T>
+BinarySearchTreeNode<T>::BinarySearchTreeNode(T&& newData) : data(std::move(newData)), left(nullptr), right(nullptr) {}
+
+template <typename T>
+template <typename... Args>
+BinarySearchTreeNode<T>::BinarySearchTreeNode(std::in_place_t, Args&&... args) : data(std::forward<Args>(args)...), left(nullptr), right(nullptr) {}
 
 template <typename T>
 T BinarySearchTreeNode<T>::getData() {
@@ -48,17 +63,144 @@ T* BinarySearchTreeNode<T>::getPData() {
 
 template <typename T>
 bool BinarySearchTreeNode<T>::operator==(const BinarySearchTreeNode<T>& otherNode) const {
-  bool dataEqual = this->data == otherNode.data;
-  bool leftEqual = (this->left == nullptr && otherNode.left == nullptr) || (this->left != nullptr && otherNode.left != nullptr && *this->left == *otherNode.left);
-  bool rightEqual = (this->right == nullptr && otherNode.right == nullptr) || (this->right != nullptr && otherNode.right != nullptr && *this->right == *otherNode.right);
-  return dataEqual && leftEqual && rightEqual;
+  // both trees are walked in the same pre-order, so matching nodes are always popped together
+  BinarySearchTreeStack<const BinarySearchTreeNode<T>*> pending, otherPending;
+  pending.push(this);
+  otherPending.push(&otherNode);
+  while (!pending.isEmpty()) {
+    const BinarySearchTreeNode<T>* current = pending.pop();
+    const BinarySearchTreeNode<T>* otherCurrent = otherPending.pop();
+    if (!(current->data == otherCurrent->data)) {
+      return false;
+    }
+    if ((current->left == nullptr) != (otherCurrent->left == nullptr) || (current->right == nullptr) != (otherCurrent->right == nullptr)) {
+      return false;
+    }
+    if (current->left) {
+      pending.push(current->left);
+      otherPending.push(otherCurrent->left);
+    }
+    if (current->right) {
+      pending.push(current->right);
+      otherPending.push(otherCurrent->right);
+    }
+  }
+  return true;
+}
+
+template <typename E>
+BinarySearchTreeStack<E>::BinarySearchTreeStack() : items(nullptr), top(0), capacity(0) {}
+
+template <typename E>
+BinarySearchTreeStack<E>::BinarySearchTreeStack(const BinarySearchTreeStack& other) : items(nullptr), top(0), capacity(0) {
+  for (int i = 0; i < other.top; i++) {
+    push(other.items[i]);
+  }
+}
+
+template <typename E>
+BinarySearchTreeStack<E>& BinarySearchTreeStack<E>::operator=(const BinarySearchTreeStack& other) {
+  if (this != &other) {
+    top = 0;
+    for (int i = 0; i < other.top; i++) {
+      push(other.items[i]);
+    }
+  }
+  return *this;
+}
+
+template <typename E>
+BinarySearchTreeStack<E>::~BinarySearchTreeStack() {
+  delete[] items;
+}
+
+template <typename E>
+void BinarySearchTreeStack<E>::push(const E& item) {
+  if (top == capacity) {
+    int newCapacity = capacity == 0 ? 16 : capacity * 2;
+    E* newItems = new E[newCapacity];
+    for (int i = 0; i < top; i++) {
+      newItems[i] = items[i];
+    }
+    delete[] items;
+    items = newItems;
+    capacity = newCapacity;
+  }
+  items[top++] = item;
+}
+
+template <typename E>
+E BinarySearchTreeStack<E>::pop() {
+  return items[--top];
+}
+
+template <typename E>
+const E& BinarySearchTreeStack<E>::peek() const {
+  return items[top - 1];
+}
+
+template <typename E>
+bool BinarySearchTreeStack<E>::isEmpty() const {
+  return top == 0;
+}
+
+template <typename T, typename V, bool Reverse>
+BinarySearchTreeIterator<T, V, Reverse>::BinarySearchTreeIterator(BinarySearchTreeNode<T>* root) {
+  pushBranch(root);
+}
+
+template <typename T, typename V, bool Reverse>
+void BinarySearchTreeIterator<T, V, Reverse>::pushBranch(BinarySearchTreeNode<T>* node) {
+  while (node) {
+    stack.push(node);
+    node = Reverse ? node->right : node->left;
+  }
+}
+
+template <typename T, typename V, bool Reverse>
+V& BinarySearchTreeIterator<T, V, Reverse>::operator*() const {
+  return stack.peek()->data;
+}
+
+template <typename T, typename V, bool Reverse>
+V* BinarySearchTreeIterator<T, V, Reverse>::operator->() const {
+  return &stack.peek()->data;
+}
+
+template <typename T, typename V, bool Reverse>
+BinarySearchTreeIterator<T, V, Reverse>& BinarySearchTreeIterator<T, V, Reverse>::operator++() {
+  BinarySearchTreeNode<T>* current = stack.pop();
+  pushBranch(Reverse ? current->left : current->right);
+  return *this;
+}
+
+template <typename T, typename V, bool Reverse>
+BinarySearchTreeIterator<T, V, Reverse> BinarySearchTreeIterator<T, V, Reverse>::operator++(int) {
+  BinarySearchTreeIterator previous = *this;
+  ++(*this);
+  return previous;
+}
+
+template <typename T, typename V, bool Reverse>
+bool BinarySearchTreeIterator<T, V, Reverse>::operator==(const BinarySearchTreeIterator& other) const {
+  return getNode() == other.getNode();
+}
+
+template <typename T, typename V, bool Reverse>
+bool BinarySearchTreeIterator<T, V, Reverse>::operator!=(const BinarySearchTreeIterator& other) const {
+  return getNode() != other.getNode();
+}
+
+template <typename T, typename V, bool Reverse>
+BinarySearchTreeNode<T>* BinarySearchTreeIterator<T, V, Reverse>::getNode() const {
+  return stack.isEmpty() ? nullptr : stack.peek();
 }
 
 template <typename T>
-BinarySearchTree<T>::BinarySearchTree() : root(nullptr) {}
+BinarySearchTree<T>::BinarySearchTree() : root(nullptr), size(0) {}
 
 template <typename T>
-BinarySearchTree<T>::BinarySearchTree(const BinarySearchTree& other) : root(nullptr) {
+BinarySearchTree<T>::BinarySearchTree(const BinarySearchTree& other) : root(nullptr), size(other.size) {
   if (other.root != nullptr) {
     root = new BinarySearchTreeNode<T>(*other.root);
   }
@@ -67,43 +209,63 @@ BinarySearchTree<T>::BinarySearchTree(const BinarySearchTree& other) : root(null
 template <typename T>
 BinarySearchTree<T>& BinarySearchTree<T>::operator=(const BinarySearchTree& other) {
   if (this != &other) {
-    deletePostOrder(root);
+    deleteSubtree(root);
     root = nullptr;
     if (other.root != nullptr) {
       root = new BinarySearchTreeNode<T>(*other.root);
     }
+    size = other.size;
   }
   return *this;
 }
 
 template <typename T>
-BinarySearchTree<T>::BinarySearchTree(BinarySearchTree&& other) : root(other.root) {
+BinarySearchTree<T>::BinarySearchTree(BinarySearchTree&& other) : root(other.root), size(other.size) {
 	other.root = nullptr;
+	other.size = 0;
 }
 
 template <typename T>
 BinarySearchTree<T>& BinarySearchTree<T>::operator=(BinarySearchTree&& other) {
-	if (this != other) {
-		deletePostOrder(root);
+	if (this != &other) {
+		deleteSubtree(root);
 		root = other.root;
+		size = other.size;
 		other.root = nullptr;
+		other.size = 0;
 	}
 	return *this;
 }
 
 template <typename T>
 BinarySearchTree<T>::~BinarySearchTree() {
-  deletePostOrder(root);
+  deleteSubtree(root);
   root = nullptr;
 }
 
 template <typename T>
 void BinarySearchTree<T>::insert(const T& data) {
-  if (!root) {
-    root = new BinarySearchTreeNode(data);
-    return;
-  }
-  recursiveInsert(data, root);
+  insertNode(new BinarySearchTreeNode<T>(data));
+}
+
+template <typename T>
+void BinarySearchTree<T>::insert(T&& data) {
+  insertNode(new BinarySearchTreeNode<T>(std::move(data)));
+}
+
+template <typename T>
+template <typename... Args>
+T& BinarySearchTree<T>::emplace(Args&&... args) {
+  return insertNode(new BinarySearchTreeNode<T>(std::in_place, std::forward<Args>(args)...));
+}
+
+template <typename T>
+template <typename InputIt>
+void BinarySearchTree<T>::buildFromSorted(InputIt first, InputIt last) {
+  deleteSubtree(root);
+  std::ptrdiff_t count = std::distance(first, last);
+  root = buildBalanced(first, count);
+  size = static_cast<int>(count);
 }
 
 template <typename T>
@@ -121,27 +283,57 @@ void BinarySearchTree<T>::remove(const T& data) {
     }
     if (toRemove == root) {
       root = temp;
-      delete toRemove;
-      return;
-    }
-    BinarySearchTreeNode<T>* parent = findParent(toRemove);
-    if (toRemove->data < parent->data) {
-      parent->left = temp;
     } else {
-      parent->right = temp;
+      BinarySearchTreeNode<T>* parent = findParent(toRemove);
+      if (parent->left == toRemove) {
+        parent->left = temp;
+      } else {
+        parent->right = temp;
+      }
     }
     delete toRemove;
+    size--;
     return;
   }
-  BinarySearchTreeNode<T>* successor = findSuccessor(toRemove);
-  T temp = successor->data;
-  remove(successor->data);
-  toRemove->data = temp;
+  // two children: the in-order successor (leftmost of the right sub-tree) takes its place and is unlinked directly
+  BinarySearchTreeNode<T>* successorParent = toRemove;
+  BinarySearchTreeNode<T>* successor = toRemove->right;
+  while (successor->left) {
+    successorParent = successor;
+    successor = successor->left;
+  }
+  if (successorParent == toRemove) {
+    successorParent->right = successor->right;
+  } else {
+    successorParent->left = successor->right;
+  }
+  toRemove->data = std::move(successor->data);
+  delete successor;
+  size--;
 }
 
 template <typename T>
 BinarySearchTreeNode<T>* BinarySearchTree<T>::search(const T& target) const {
-  return recursiveSearch(target, root);
+  // equal keys can be on both sides in a bulk loaded tree; the right sides still to check wait in the stack
+  BinarySearchTreeStack<BinarySearchTreeNode<T>*> pending;
+  BinarySearchTreeNode<T>* current = root;
+  while (current || !pending.isEmpty()) {
+    if (!current) {
+      current = pending.pop();
+    } else if (target == current->data) {
+      return current;
+    } else if (target <= current->data && current->data <= target) {
+      if (current->right) {
+        pending.push(current->right);
+      }
+      current = current->left;
+    } else if (target <= current->data) {
+      current = current->left;
+    } else {
+      current = current->right;
+    }
+  }
+  return nullptr;
 }
 
 template <typename T>
@@ -151,7 +343,9 @@ void BinarySearchTree<T>::print() {
     std::cout << "Tree is empty" << std::endl;
     return;
   }
-  printInOrder(root);
+  for (const T& data : *this) {
+    std::cout << data << " ";
+  }
   std::cout << std::endl;
 }
 
@@ -160,91 +354,76 @@ BinarySearchTreeNode<T>* BinarySearchTree<T>::findParent(const BinarySearchTreeN
   if (child == root) {
     return nullptr;
   }
-  BinarySearchTreeNode<T>* parent = root;
-  while (parent) {
-    if (parent->left == child || parent->right == child) {
-      return parent;
-    }
-    if (child->data <= parent->data) {
-      parent = parent->left;
+  // same walk as search, but looking for the node by address
+  BinarySearchTreeStack<BinarySearchTreeNode<T>*> pending;
+  BinarySearchTreeNode<T>* current = root;
+  while (current || !pending.isEmpty()) {
+    if (!current) {
+      current = pending.pop();
+    } else if (current->left == child || current->right == child) {
+      return current;
+    } else if (child->data <= current->data && current->data <= child->data) {
+      if (current->right) {
+        pending.push(current->right);
+      }
+      current = current->left;
+    } else if (child->data <= current->data) {
+      current = current->left;
     } else {
-      parent = parent->right;
+      current = current->right;
     }
   }
   return nullptr;
 }
 
 template <typename T>
-BinarySearchTreeNode<T>* BinarySearchTree<T>::findSuccessor(const BinarySearchTreeNode<T>* predecessor) {
-  BinarySearchTreeNode<T>* successor = predecessor->right;
-  while (successor && successor->left) {
-    successor = successor->left;
+template <typename InputIt>
+BinarySearchTreeNode<T>* BinarySearchTree<T>::buildBalanced(InputIt& current, std::ptrdiff_t count) {
+  if (count <= 0) {
+    return nullptr;
   }
-  return successor;
+  // in-order: the left half uses the first elements, then the middle one becomes the root
+  BinarySearchTreeNode<T>* left = buildBalanced(current, count / 2);
+  BinarySearchTreeNode<T>* middle = new BinarySearchTreeNode<T>(*current);
+  ++current;
+  middle->left = left;
+  middle->right = buildBalanced(current, count - count / 2 - 1);
+  return middle;
 }
 
 template <typename T>
-BinarySearchTreeNode<T>* BinarySearchTree<T>::recursiveSearch(const T& target, BinarySearchTreeNode<T>* current) const {
-  if (!current) {
-    return nullptr;
-  }
-  if (target == current->data) {
-    return current;
-  } else if (target < current->data) {
-		return recursiveSearch(target, current->left);
-  } else {
-    return recursiveSearch(target, current->right);
+T& BinarySearchTree<T>::insertNode(BinarySearchTreeNode<T>* newNode) {
+  BinarySearchTreeNode<T>** link = &root;
+  while (*link) {
+    link = newNode->data <= (*link)->data ? &(*link)->left : &(*link)->right;
   }
+  *link = newNode;
+  size++;
+  return newNode->data;
 }
 
 template <typename T>
-void BinarySearchTree<T>::recursiveInsert(const T& data, BinarySearchTreeNode<T>* current) {
-  if (data <= current->data) {
-    if (!current->left) {
-      current->left = new BinarySearchTreeNode(data);
-    } else {
-      recursiveInsert(data, current->left);
-    }
-  } else {
-    if (!current->right) {
-      current->right = new BinarySearchTreeNode(data);
+void BinarySearchTree<T>::deleteSubtree(BinarySearchTreeNode<T>* current) {
+  while (current) {
+    if (current->left) {
+      // rotate right until the current node has no left child; O(n) rotations in total
+      BinarySearchTreeNode<T>* left = current->left;
+      current->left = left->right;
+      left->right = current;
+      current = left;
     } else {
-      recursiveInsert(data, current->right);
+      BinarySearchTreeNode<T>* right = current->right;
+      delete current;
+      current = right;
     }
   }
 }
 
-template <typename T>
-void BinarySearchTree<T>::printInOrder(const BinarySearchTreeNode<T>* current) {
-  if (!current) {
-    return;
-  }
-  printInOrder(current->left);
-  std::cout << current->data << " ";
-  printInOrder(current->right);
-}
-
-template <typename T>
-void BinarySearchTree<T>::deletePostOrder(BinarySearchTreeNode<T>* current) {
-  if (current) {
-    deletePostOrder(current->left);
-    deletePostOrder(current->right);
-    delete current;
-  }
-}
-
-template <typename T>
-int BinarySearchTree<T>::getSizeRecursive(BinarySearchTreeNode<T>* current) {
-	if (!current) {
-		return 0;
-	}
-	return 1 + getSizeRecursive(current->left) + getSizeRecursive(current->right);
-}
-
 template <typename T>
 void BinarySearchTree<T>::clear() {
-  deletePostOrder(root);
+  deleteSubtree(root);
   root = nullptr;
+  size = 0;
 }
 
 template <typename T>
@@ -270,11 +449,48 @@ BinarySearchTreeNode<T>* BinarySearchTree<T>::getMax() {
 }
 
 template<typename T>
-int BinarySearchTree<T>::getSize() {
-	if (!root) {
-		return 0;
-	}
-	return 1 + getSizeRecursive(root->left) + getSizeRecursive(root->right);
+int BinarySearchTree<T>::getSize() const {
+	return size;
+}
+
+template <typename T>
+typename BinarySearchTree<T>::iterator BinarySearchTree<T>::begin() {
+  return iterator(root);
+}
+
+template <typename T>
+typename BinarySearchTree<T>::iterator BinarySearchTree<T>::end() {
+  return iterator(nullptr);
+}
+
+template <typename T>
+typename BinarySearchTree<T>::const_iterator BinarySearchTree<T>::begin() const {
+  return const_iterator(root);
+}
+
+template <typename T>
+typename BinarySearchTree<T>::const_iterator BinarySearchTree<T>::end() const {
+  return const_iterator(nullptr);
+}
+
+template <typename T>
+typename BinarySearchTree<T>::reverse_iterator BinarySearchTree<T>::rbegin() {
+  return reverse_iterator(root);
+}
+
+template <typename T>
+typename BinarySearchTree<T>::reverse_iterator BinarySearchTree<T>::rend() {
+  return reverse_iterator(nullptr);
+}
+
+template <typename T>
+typename BinarySearchTree<T>::const_reverse_iterator BinarySearchTree<T>::rbegin() const {
+  return const_reverse_iterator(root);
+}
+
+template <typename T>
+typename BinarySearchTree<T>::const_reverse_iterator BinarySearchTree<T>::rend() const {
+  return const_reverse_iterator(nullptr);
 }
 
 template <typename T>
@@ -0,0 +1,61 @@
+#include <mpscQueue.hxx>
+
+template <typename T>
+MPSCQueueNode<T>::MPSCQueueNode() : data(), next(nullptr) {}
+
+template <typename T>
+MPSCQueueNode<T>::MPSCQueueNode(const T& newData) : data(newData), next(nullptr) {}
+
+template <typename T>
+MPSCQueueNode<T>::MPSCQueueNode(T&& newData) : data(std::move(newData)), next(nullptr) {}
+
+template <typename T>
+MPSCQueue<T>::MPSCQueue() {
+  MPSCQueueNode<T>* stub = new MPSCQueueNode<T>();
+  head.store(stub, std::memory_order_relaxed);
+  tail = stub;
+}
+
+template <typename T>
+MPSCQueue<T>::~MPSCQueue() {
+  while (tail) {
+    MPSCQueueNode<T>* next = tail->next.load(std::memory_order_relaxed);
+    delete tail;
+    tail = next;
+  }
+}
+
+template <typename T>
+void MPSCQueue<T>::pushNode(MPSCQueueNode<T>* node) {
+  // after the exchange the node is reachable by later producers, but the consumer only sees it once prev->next is published
+  MPSCQueueNode<T>* previous = head.exchange(node, std::memory_order_acq_rel);
+  previous->next.store(node, std::memory_order_release);
+}
+
+template <typename T>
+void MPSCQueue<T>::push(const T& data) {
+  pushNode(new MPSCQueueNode<T>(data));
+}
+
+template <typename T>
+void MPSCQueue<T>::push(T&& data) {
+  pushNode(new MPSCQueueNode<T>(std::move(data)));
+}
+
+template <typename T>
+bool MPSCQueue<T>::tryPop(T& out) {
+  MPSCQueueNode<T>* next = tail->next.load(std::memory_order_acquire);
+  if (!next) {
+    return false;
+  }
+  // next becomes the new stub once its data has been taken
+  out = std::move(next->data);
+  delete tail;
+  tail = next;
+  return true;
+}
+
+template <typename T>
+bool MPSCQueue<T>::isEmpty() const {
+  return tail->next.load(std::memory_order_acquire) == nullptr;
+}
@@ -0,0 +1,411 @@
+#include <scheduler.h>
+#include <profiler.h>
+
+// === CICLO DEL PLANIFICADOR ===
+
+template <typename Self>
+void Scheduler::runLoopWith(Self& self) {
+	while (self.hasUnfinishedProcesses() || hasPendingSubmissions()) {
+		if (!self.hasUnfinishedProcesses()) {
+			// planificador ocioso esperando envios: no hay nada que ejecutar ni que mostrar
+			if (admitSubmittedProcesses() == 0) {
+				waitForSubmissions();
+			}
+			continue;
+		}
+		checkBlockedProcessesWith(self);
+		executeQuantumWith(self);
+		admitSubmittedProcesses();
+		{
+			PROFILE_SCOPE(ProfilePhase::SELECT_NEXT_PROCESS);
+			self.selectNextProcess();
+		}
+		startCurrentProcess();
+		self.displayStatus();
+		publishStatus();
+	}
+}
+
+template <typename Self>
+void Scheduler::executeQuantumWith(Self& self) {
+	PROFILE_SCOPE(ProfilePhase::EXECUTE_QUANTUM);
+	if (!currentProcess) {
+		return;
+	}
+	if (nativeBackend && currentProcess->hasCommand()) {
+		executeNativeQuantum();
+		return;
+	}
+
+	executeInstructions();
+	switch(currentProcess->getState()) {
+		case ProcessState::FINISHED:
+			moveToFinished(currentProcess);
+			break;
+		case ProcessState::BLOCKED:
+			moveToBlocked(currentProcess);
+			break;
+		case ProcessState::RUNNING_PREEMPTED:
+			self.moveToReady(currentProcess);
+			break;
+		default:
+			break;
+	}
+
+	checkBlockedProcessesWith(self);
+}
+
+template <typename Self>
+void Scheduler::checkBlockedProcessesWith(Self& self) {
+	PROFILE_SCOPE(ProfilePhase::CHECK_BLOCKED_PROCESSES);
+	double current = now();
+	for (int index = 0; index < deviceCount; index++) {
+		Process* done;
+		while ((done = devices[index]->nextCompleted(current))) {
+			Process process = *done;
+			self.moveToReady(&process);
+		}
+	}
+}
+
+// === NUCLEO ===
+
+template <typename Policy, typename Queue>
+SchedulerCore<Policy, Queue>::SchedulerCore(const Policy& newPolicy, const Queue& newQueue) : Scheduler(), policy(newPolicy),
+	ready(newQueue) {}
+
+template <typename Policy, typename Queue>
+void SchedulerCore<Policy, Queue>::runLoop() {
+	if (dynamicDispatch) {
+		Scheduler::runLoop();
+	} else {
+		runLoopWith(*this);
+	}
+}
+
+template <typename Policy, typename Queue>
+void SchedulerCore<Policy, Queue>::selectNextProcess() {
+	policy.select(*this);
+}
+
+template <typename Policy, typename Queue>
+float SchedulerCore<Policy, Queue>::getQuantumSlice() const {
+	return policy.getQuantumSlice();
+}
+
+template <typename Policy, typename Queue>
+bool SchedulerCore<Policy, Queue>::popReady(Process& out) {
+	return policy.pop(*this, out);
+}
+
+template <typename Policy, typename Queue>
+bool SchedulerCore<Policy, Queue>::takeReady(const std::string& group, Process& out) {
+	return policy.take(*this, group, out);
+}
+
+template <typename Policy, typename Queue>
+void SchedulerCore<Policy, Queue>::removeReady(const Process& process) {
+	policy.remove(*this, process);
+}
+
+template <typename Policy, typename Queue>
+bool SchedulerCore<Policy, Queue>::hasUnfinishedProcesses() {
+	return policy.hasUnfinished(*this);
+}
+
+template <typename Policy, typename Queue>
+void SchedulerCore<Policy, Queue>::displayStatus() {
+	std::cout << "Procesos listos: " << ready.getSize() << std::endl;
+	std::cout << "Procesos bloqueados: " << getBlockedCount() << std::endl;
+	std::cout << "Procesos terminados: " << finishedProcesses->getSize() << std::endl;
+	std::cout << std::endl;
+}
+
+template <typename Policy, typename Queue>
+int SchedulerCore<Policy, Queue>::getReadyCount() const {
+	return ready.getSize();
+}
+
+template <typename Policy, typename Queue>
+void SchedulerCore<Policy, Queue>::addProcess(Process* newProcess) {
+	policy.admit(*this, newProcess);
+}
+
+template <typename Policy, typename Queue>
+void SchedulerCore<Policy, Queue>::moveToReady(Process* process) {
+	PROFILE_SCOPE(ProfilePhase::MOVE_TO_READY);
+	policy.requeue(*this, process);
+}
+
+// === ROUND ROBIN ===
+
+template <typename Core>
+void RoundRobinPolicy::select(Core& core) {
+	// un proceso cortado ya volvio al final de la cola (moveToReady); al frente sigue la copia con la que se despacho
+	bool preempted = false;
+	Process previous;
+	if (core.currentProcess) {
+		preempted = core.stickyEqualPriority && core.currentProcess->getState() == ProcessState::READY;
+		if (preempted) {
+			previous = *core.currentProcess;
+		}
+		core.ready.deleteByValue(*core.currentProcess);
+		delete core.currentProcess;
+		core.currentProcess = nullptr;
+	}
+	if (core.ready.getSize() == 0) {
+		if (core.getBlockedCount() > 0) {
+			Process* blocked = core.peekBlockedProcess();
+			core.waitUntil(blocked->getTimes().ioDone);
+			core.currentProcess = new Process(*blocked);
+			core.Core::moveToReady(core.currentProcess);
+			core.currentProcess->setQuantum(quantumSlice);
+		}
+		return;
+	}
+
+	if (preempted && core.ready.getHead()->getPData()->getPriority() == previous.getPriority()) {
+		core.ready.deleteByValue(previous);
+		core.ready.insertHead(previous);
+	}
+	core.currentProcess = new Process(*core.ready.getHead()->getPData());
+	core.currentProcess->setQuantum(quantumSlice);
+}
+
+template <typename Core>
+bool RoundRobinPolicy::hasUnfinished(Core& core) {
+	return core.ready.getSize() > 0 || core.getBlockedCount() > 0;
+}
+
+template <typename Core>
+void RoundRobinPolicy::admit(Core& core, Process* newProcess) {
+	core.noteArrival(*newProcess);
+	core.ready.insertTail(*newProcess);
+}
+
+template <typename Core>
+void RoundRobinPolicy::requeue(Core& core, Process* process) {
+	core.removeProcess(process);
+	core.noteReady(*process);
+	if (process->getState() == ProcessState::BLOCKED) {
+		process->finishIO();
+	}
+
+	process->setState(ProcessState::READY);
+	core.ready.insertTail(*process);
+}
+
+template <typename Core>
+bool RoundRobinPolicy::pop(Core& core, Process& out) {
+	if (core.ready.getSize() == 0) {
+		return false;
+	}
+	out = core.ready.popFront();
+	return true;
+}
+
+template <typename Core>
+bool RoundRobinPolicy::take(Core& core, const std::string& group, Process& out) {
+	for (const Process& process : core.ready) {
+		if (process.getGroup() == group) {
+			out = process;
+			core.ready.deleteByValue(out);
+			return true;
+		}
+	}
+	return false;
+}
+
+template <typename Core>
+void RoundRobinPolicy::remove(Core& core, const Process& process) {
+	core.ready.deleteByValue(process);
+}
+
+// === PLANIFICACION POR PRIORIDAD ===
+
+template <typename Core>
+void PriorityPolicy::adjustPriority(Core& core, Process& process) {
+	process.setPriority(process.projectPriority(process.getPriority(), process.getInstructionIndex()));
+
+	core.ready.insert(process);
+}
+
+template <typename Core>
+void PriorityPolicy::select(Core& core) {
+	// un proceso cortado ya volvio al arbol con su nueva prioridad (moveToReady); los demas salen del arbol
+	bool preempted = false;
+	Process previous;
+	if (core.currentProcess) {
+		preempted = core.currentProcess->getState() == ProcessState::READY;
+		if (preempted) {
+			previous = *core.currentProcess;
+		} else {
+			core.ready.remove(*core.currentProcess);
+		}
+		delete core.currentProcess;
+		core.currentProcess = nullptr;
+	}
+	if (core.ready.getSize() == 0) {
+		if (core.getBlockedCount() > 0) {
+			Process* blocked = core.peekBlockedProcess();
+			core.waitUntil(blocked->getTimes().ioDone);
+			core.currentProcess = new Process(*blocked);
+			core.Core::moveToReady(core.currentProcess);
+		}
+		return;
+	}
+
+	Process* next = core.ready.getMax()->getPData();
+	if (core.stickyEqualPriority && preempted && next->getPriority() == previous.getPriority()) {
+		BinarySearchTreeNode<Process>* node = core.ready.search(previous);
+		if (node) {
+			next = node->getPData();
+		}
+	}
+	core.currentProcess = new Process(*next);
+	core.currentProcess->setQuantum(getQuantumSlice());
+}
+
+template <typename Core>
+bool PriorityPolicy::hasUnfinished(Core& core) {
+	return core.ready.getRoot() != nullptr || core.getBlockedCount() > 0;
+}
+
+template <typename Core>
+void PriorityPolicy::admit(Core& core, Process* newProcess) {
+	core.noteArrival(*newProcess);
+	calculateInitialPriority(*newProcess);
+	core.ready.insert(*newProcess);
+}
+
+template <typename Core>
+void PriorityPolicy::requeue(Core& core, Process* process) {
+	core.removeProcess(process);
+	core.noteReady(*process);
+	if (process->getState() == ProcessState::BLOCKED) {
+		process->finishIO();
+	} else if (process->getState() == ProcessState::RUNNING_PREEMPTED) {
+		// la copia que quedo en el arbol al despacharlo tiene la prioridad y el avance de antes
+		core.ready.remove(*process);
+	}
+
+	process->setState(ProcessState::READY);
+	adjustPriority(core, *process);
+}
+
+template <typename Core>
+bool PriorityPolicy::pop(Core& core, Process& out) {
+	BinarySearchTreeNode<Process>* max = core.ready.getMax();
+	if (!max) {
+		return false;
+	}
+	out = *max->getPData();
+	core.ready.remove(out);
+	return true;
+}
+
+template <typename Core>
+bool PriorityPolicy::take(Core& core, const std::string& group, Process& out) {
+	for (auto it = core.ready.rbegin(); it != core.ready.rend(); ++it) {
+		if (it->getGroup() == group) {
+			out = *it;
+			core.ready.remove(out);
+			return true;
+		}
+	}
+	return false;
+}
+
+template <typename Core>
+void PriorityPolicy::remove(Core& core, const Process& process) {
+	if (core.ready.search(process)) {
+		core.ready.remove(process);
+	}
+}
+
+// === TIEMPO REAL ===
+
+template <typename Core>
+void DeadlinePolicy::select(Core& core) {
+	// el proceso en ejecucion no esta en el heap; si lo cortaron, moveToReady ya lo devolvio
+	bool preempted = false;
+	Process previous;
+	if (core.currentProcess) {
+		preempted = core.stickyEqualPriority && core.currentProcess->getState() == ProcessState::READY;
+		if (preempted) {
+			previous = *core.currentProcess;
+		}
+		delete core.currentProcess;
+		core.currentProcess = nullptr;
+	}
+	if (core.ready.isEmpty()) {
+		if (core.getBlockedCount() == 0) {
+			return;
+		}
+		Process* blocked = core.peekBlockedProcess();
+		core.waitUntil(blocked->getTimes().ioDone);
+		Process process = *blocked;
+		core.Core::moveToReady(&process);
+	}
+
+	if (preempted && !before(core.ready.top(), previous) && core.ready.remove(previous)) {
+		core.currentProcess = new Process(std::move(previous));
+	} else {
+		core.currentProcess = new Process(core.ready.pop());
+	}
+	core.currentProcess->setQuantum(quantumSlice);
+}
+
+template <typename Core>
+bool DeadlinePolicy::hasUnfinished(Core& core) {
+	return !core.ready.isEmpty() || core.currentProcess != nullptr || core.getBlockedCount() > 0;
+}
+
+template <typename Core>
+void DeadlinePolicy::admit(Core& core, Process* newProcess) {
+	core.noteArrival(*newProcess);
+	core.ready.push(*newProcess);
+}
+
+template <typename Core>
+void DeadlinePolicy::requeue(Core& core, Process* process) {
+	core.removeProcess(process);
+	core.noteReady(*process);
+	if (process->getState() == ProcessState::BLOCKED) {
+		process->finishIO();
+	}
+
+	process->setState(ProcessState::READY);
+	core.ready.push(*process);
+}
+
+template <typename Core>
+bool DeadlinePolicy::pop(Core& core, Process& out) {
+	if (core.ready.isEmpty()) {
+		return false;
+	}
+	out = core.ready.pop();
+	return true;
+}
+
+template <typename Core>
+bool DeadlinePolicy::take(Core& core, const std::string& group, Process& out) {
+	int first = -1;
+	for (int index = 0; index < core.ready.getSize(); index++) {
+		const Process& process = core.ready.at(index);
+		if (process.getGroup() == group && (first < 0 || before(process, core.ready.at(first)))) {
+			first = index;
+		}
+	}
+	if (first < 0) {
+		return false;
+	}
+	out = core.ready.at(first);
+	core.ready.remove(out);
+	return true;
+}
+
+template <typename Core>
+void DeadlinePolicy::remove(Core& core, const Process& process) {
+	core.ready.remove(process);
+}
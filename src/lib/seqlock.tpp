@@ -0,0 +1,59 @@
+#include <seqlock.hxx>
+#include <thread>
+
+template <typename T>
+Seqlock<T>::Seqlock() : sequence(0) {
+  unsigned long long buffer[WORD_COUNT] = {};
+  T data = T();
+  std::memcpy(buffer, &data, sizeof(T));
+  for (int index = 0; index < WORD_COUNT; index++) {
+    words[index].store(buffer[index], std::memory_order_relaxed);
+  }
+}
+
+template <typename T>
+void Seqlock<T>::write(const T& data) {
+  unsigned long long buffer[WORD_COUNT] = {};
+  std::memcpy(buffer, &data, sizeof(T));
+  unsigned long long start = sequence.load(std::memory_order_relaxed);
+  sequence.store(start + 1, std::memory_order_relaxed);
+  // the odd sequence must be visible before any word changes
+  std::atomic_thread_fence(std::memory_order_release);
+  for (int index = 0; index < WORD_COUNT; index++) {
+    words[index].store(buffer[index], std::memory_order_relaxed);
+  }
+  sequence.store(start + 2, std::memory_order_release);
+}
+
+template <typename T>
+bool Seqlock<T>::tryRead(T& out) const {
+  unsigned long long before = sequence.load(std::memory_order_acquire);
+  if (before & 1) {
+    return false;
+  }
+  unsigned long long buffer[WORD_COUNT];
+  for (int index = 0; index < WORD_COUNT; index++) {
+    buffer[index] = words[index].load(std::memory_order_relaxed);
+  }
+  // the words must be read before checking that the sequence did not move
+  std::atomic_thread_fence(std::memory_order_acquire);
+  if (sequence.load(std::memory_order_relaxed) != before) {
+    return false;
+  }
+  std::memcpy(&out, buffer, sizeof(T));
+  return true;
+}
+
+template <typename T>
+T Seqlock<T>::read() const {
+  T out;
+  while (!tryRead(out)) {
+    std::this_thread::yield();
+  }
+  return out;
+}
+
+template <typename T>
+unsigned long long Seqlock<T>::getVersion() const {
+  return sequence.load(std::memory_order_acquire) / 2;
+}
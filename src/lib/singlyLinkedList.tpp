@@ -4,7 +4,14 @@ template <typename T>
 SinglyLinkedListNode<T>::SinglyLinkedListNode() : data(), next(nullptr) {};
 
 template <typename T> 
-SinglyLinkedListNode<T>::SinglyLinkedListNode(T newData) : data(newData), next(nullptr) {};
+SinglyLinkedListNode<T>::SinglyLinkedListNode(const T& newData) : data(newData), next(nullptr) {};
+
+template <typename T>
+SinglyLinkedListNode<T>::SinglyLinkedListNode(T&& newData) : data(std::move(newData)), next(nullptr) {};
+
+template <typename T>
+template <typename... Args>
+SinglyLinkedListNode<T>::SinglyLinkedListNode(std::in_place_t, Args&&... args) : data(std::forward<Args>(args)...), next(nullptr) {};
 
 template <typename T>
 SinglyLinkedListNode<T>::SinglyLinkedListNode(const SinglyLinkedListNode& other) : data(other.data), next(other.next ? new SinglyLinkedListNode(*other.next) : nullptr) {}
@@ -24,11 +31,55 @@ SinglyLinkedListNode<T>* SinglyLinkedListNode<T>::getNext() {
 	return next;
 }
 
+template <typename T, typename V>
+SinglyLinkedListIterator<T, V>::SinglyLinkedListIterator(SinglyLinkedListNode<T>* node) : current(node) {}
+
+template <typename T, typename V>
+SinglyLinkedListIterator<T, V>::SinglyLinkedListIterator(const SinglyLinkedListIterator<T, T>& other) : current(other.getNode()) {}
+
+template <typename T, typename V>
+V& SinglyLinkedListIterator<T, V>::operator*() const {
+  return current->data;
+}
+
+template <typename T, typename V>
+V* SinglyLinkedListIterator<T, V>::operator->() const {
+  return &current->data;
+}
+
+template <typename T, typename V>
+SinglyLinkedListIterator<T, V>& SinglyLinkedListIterator<T, V>::operator++() {
+  current = current->next;
+  return *this;
+}
+
+template <typename T, typename V>
+SinglyLinkedListIterator<T, V> SinglyLinkedListIterator<T, V>::operator++(int) {
+  SinglyLinkedListIterator previous = *this;
+  current = current->next;
+  return previous;
+}
+
+template <typename T, typename V>
+bool SinglyLinkedListIterator<T, V>::operator==(const SinglyLinkedListIterator& other) const {
+  return current == other.current;
+}
+
+template <typename T, typename V>
+bool SinglyLinkedListIterator<T, V>::operator!=(const SinglyLinkedListIterator& other) const {
+  return current != other.current;
+}
+
+template <typename T, typename V>
+SinglyLinkedListNode<T>* SinglyLinkedListIterator<T, V>::getNode() const {
+  return current;
+}
+
 template <typename T>
-SinglyLinkedList<T>::SinglyLinkedList() : head (nullptr), size(0) {};
+SinglyLinkedList<T>::SinglyLinkedList() : head (nullptr), tail(nullptr), size(0) {};
 
 template <typename T>
-SinglyLinkedList<T>::SinglyLinkedList(const SinglyLinkedList<T>& other) : head(nullptr), size(0) {
+SinglyLinkedList<T>::SinglyLinkedList(const SinglyLinkedList<T>& other) : head(nullptr), tail(nullptr), size(0) {
   if (other.head == nullptr) {
     return;
   }
@@ -42,6 +93,7 @@ SinglyLinkedList<T>::SinglyLinkedList(const SinglyLinkedList<T>& other) : head(n
     otherCurrent = otherCurrent->next;
     size++;
   }
+  tail = current;
 }
 
 template <typename T>
@@ -63,18 +115,19 @@ SinglyLinkedList<T>& SinglyLinkedList<T>::operator=(const SinglyLinkedList<T>& o
     otherCurrent = otherCurrent->next;
     size++;
   }
+  tail = current;
   return *this;
 }
 
 template <typename T>
-SinglyLinkedListNode<T>::SinglyLinkedListNode(SinglyLinkedListNode&& other) : data(other.data), next(other.next) {
+SinglyLinkedListNode<T>::SinglyLinkedListNode(SinglyLinkedListNode&& other) : data(std::move(other.data)), next(other.next) {
 	other.next = nullptr;
 }
 
 template <typename T>
 SinglyLinkedListNode<T>& SinglyLinkedListNode<T>::operator=(SinglyLinkedListNode&& other) {
-	if (this != other) {
-		data = other.data;
+	if (this != &other) {
+		data = std::move(other.data);
 		delete next;
 		next = other.next;
 		other.next = nullptr;
@@ -83,18 +136,21 @@ SinglyLinkedListNode<T>& SinglyLinkedListNode<T>::operator=(SinglyLinkedListNode
 }
 
 template <typename T>
-SinglyLinkedList<T>::SinglyLinkedList(SinglyLinkedList&& other) : head(other.head), size(other.size) {
+SinglyLinkedList<T>::SinglyLinkedList(SinglyLinkedList&& other) : head(other.head), tail(other.tail), size(other.size) {
 	other.head = nullptr;
+	other.tail = nullptr;
 	other.size = 0;
 }
 
 template <typename T>
-SinglyLinkedList<T>&& SinglyLinkedList<T>::operator=(SinglyLinkedList&& other) {
-	if (this != other) {
+SinglyLinkedList<T>& SinglyLinkedList<T>::operator=(SinglyLinkedList&& other) {
+	if (this != &other) {
 		clear();
 		head = other.head;
+		tail = other.tail;
 		size = other.size;
 		other.head = nullptr;
+		other.tail = nullptr;
 		other.size = 0;
 	}
 	return *this;
@@ -112,25 +168,65 @@ void SinglyLinkedList<T>::insertHead(const T& data) {
   SinglyLinkedListNode<T>* newNode = new SinglyLinkedListNode<T>(data);
   newNode->next = head;
   head = newNode;
+  if (tail == nullptr) {
+    tail = newNode;
+  }
   size++;
 }
 
 template <typename T>
-void SinglyLinkedList<T>::insertTail(const T& data) {
-  SinglyLinkedListNode<T>* newNode = new SinglyLinkedListNode<T>(data);
-  if (head == nullptr) {
-    head = newNode;
-    size++;
-    return;
+void SinglyLinkedList<T>::insertHead(T&& data) {
+  SinglyLinkedListNode<T>* newNode = new SinglyLinkedListNode<T>(std::move(data));
+  newNode->next = head;
+  head = newNode;
+  if (tail == nullptr) {
+    tail = newNode;
   }
-  SinglyLinkedListNode<T>* current = head;
-  while (current->next != nullptr) {
-    current = current->next;
+  size++;
+}
+
+template <typename T>
+template <typename... Args>
+T& SinglyLinkedList<T>::emplaceHead(Args&&... args) {
+  SinglyLinkedListNode<T>* newNode = new SinglyLinkedListNode<T>(std::in_place, std::forward<Args>(args)...);
+  newNode->next = head;
+  head = newNode;
+  if (tail == nullptr) {
+    tail = newNode;
   }
-  current->next = newNode;
+  size++;
+  return newNode->data;
+}
+
+template <typename T>
+void SinglyLinkedList<T>::linkTail(SinglyLinkedListNode<T>* newNode) {
+  if (tail == nullptr) {
+    head = newNode;
+  } else {
+    tail->next = newNode;
+  }
+  tail = newNode;
   size++;
 }
 
+template <typename T>
+void SinglyLinkedList<T>::insertTail(const T& data) {
+  linkTail(new SinglyLinkedListNode<T>(data));
+}
+
+template <typename T>
+void SinglyLinkedList<T>::insertTail(T&& data) {
+  linkTail(new SinglyLinkedListNode<T>(std::move(data)));
+}
+
+template <typename T>
+template <typename... Args>
+T& SinglyLinkedList<T>::emplaceTail(Args&&... args) {
+  SinglyLinkedListNode<T>* newNode = new SinglyLinkedListNode<T>(std::in_place, std::forward<Args>(args)...);
+  linkTail(newNode);
+  return newNode->data;
+}
+
 template <typename T>
 void SinglyLinkedList<T>::insertAfter(const T& target, const T& data) {
   if (head == nullptr) {
@@ -146,6 +242,9 @@ void SinglyLinkedList<T>::insertAfter(const T& target, const T& data) {
   SinglyLinkedListNode<T>* newNode = new SinglyLinkedListNode<T>(data);
   newNode->next = current->next;
   current->next = newNode;
+  if (current == tail) {
+    tail = newNode;
+  }
   size++;
 }
 
@@ -224,6 +323,9 @@ void SinglyLinkedList<T>::deleteHead() {
   }
   SinglyLinkedListNode<T>* oldHead = head;
   head = head->next;
+  if (head == nullptr) {
+    tail = nullptr;
+  }
 	oldHead->next = nullptr;
   delete oldHead;
   size--;
@@ -244,8 +346,19 @@ void SinglyLinkedList<T>::deleteTail() {
   }
   delete current->next;
   current->next = nullptr;
+  tail = current;
   size--;
 }
+
+template <typename T>
+T SinglyLinkedList<T>::popFront() {
+  if (head == nullptr) {
+    throw std::out_of_range("popFront on an empty list");
+  }
+  T data = std::move(head->data);
+  deleteHead();
+  return data;
+}
     
 template <typename T>
 void SinglyLinkedList<T>::deleteAfter(const T& target) {
@@ -261,6 +374,9 @@ void SinglyLinkedList<T>::deleteAfter(const T& target) {
   }
   SinglyLinkedListNode<T>* targetNode = current->next;
   current->next = current->next->next;
+  if (targetNode == tail) {
+    tail = current;
+  }
   delete targetNode;
   size--;
 }
@@ -299,6 +415,9 @@ void SinglyLinkedList<T>::deleteAt(int position) {
     return;
   }
   previous->next = current->next;
+  if (current == tail) {
+    tail = previous;
+  }
   delete current;
   size--;
 }
@@ -321,6 +440,9 @@ void SinglyLinkedList<T>::deleteByValue(const T& target) {
   }
   SinglyLinkedListNode<T>* targetNode = current->next;
   current->next = targetNode->next;
+  if (targetNode == tail) {
+    tail = current;
+  }
   delete targetNode;
   size--;
 }
@@ -332,11 +454,7 @@ SinglyLinkedListNode<T>* SinglyLinkedList<T>::getHead() {
 
 template <typename T>
 SinglyLinkedListNode<T>* SinglyLinkedList<T>::getTail() {
-  SinglyLinkedListNode<T>* current = head;
-  while (current->next) {
-    current = current->next;
-  }
-  return current;
+  return tail;
 }
 
 template <typename T>
@@ -355,10 +473,30 @@ SinglyLinkedListNode<T>* SinglyLinkedList<T>::getAt(const int position) {
 }
 
 template <typename T>
-int SinglyLinkedList<T>::getSize() {
+int SinglyLinkedList<T>::getSize() const {
   return size;
 }
 
+template <typename T>
+typename SinglyLinkedList<T>::iterator SinglyLinkedList<T>::begin() {
+  return iterator(head);
+}
+
+template <typename T>
+typename SinglyLinkedList<T>::iterator SinglyLinkedList<T>::end() {
+  return iterator(nullptr);
+}
+
+template <typename T>
+typename SinglyLinkedList<T>::const_iterator SinglyLinkedList<T>::begin() const {
+  return const_iterator(head);
+}
+
+template <typename T>
+typename SinglyLinkedList<T>::const_iterator SinglyLinkedList<T>::end() const {
+  return const_iterator(nullptr);
+}
+
 template <typename T>
 SinglyLinkedListNode<T>* SinglyLinkedList<T>::search(const T& target) const {
   if (head == nullptr) {
@@ -373,24 +511,58 @@ SinglyLinkedListNode<T>* SinglyLinkedList<T>::search(const T& target) const {
 
 template <typename T>
 void SinglyLinkedList<T>::sort() {
+  sortBy([](const T& a, const T& b) { return b > a; });
+}
+
+template <typename T>
+template <typename Compare>
+void SinglyLinkedList<T>::sortBy(Compare compare) {
   if (head == nullptr || head->next == nullptr) {
     return;
   }
-  bool swapMade;
-  SinglyLinkedListNode<T>* current;
-  SinglyLinkedListNode<T>* last = nullptr;
-  do {
-    swapMade = false;
-    current = head;
-    while (current && current->next != last) {
-      if (current->data > current->next->data) {
-        swapData(current, current->next);
-        swapMade = true;
+  // bottom-up: merge runs of width 1, 2, 4... until a single run covers the whole list
+  for (int width = 1; width < size; width *= 2) {
+    SinglyLinkedListNode<T>* remaining = head;
+    SinglyLinkedListNode<T>* mergedTail = nullptr;
+    head = nullptr;
+    while (remaining != nullptr) {
+      SinglyLinkedListNode<T>* left = remaining;
+      SinglyLinkedListNode<T>* right = splitAfter(left, width);
+      remaining = splitAfter(right, width);
+      while (left != nullptr || right != nullptr) {
+        SinglyLinkedListNode<T>* taken;
+        // right only goes first if it is strictly smaller; ties keep the left (earlier) node first
+        if (right == nullptr || (left != nullptr && !compare(right->data, left->data))) {
+          taken = left;
+          left = left->next;
+        } else {
+          taken = right;
+          right = right->next;
+        }
+        if (mergedTail == nullptr) {
+          head = taken;
+        } else {
+          mergedTail->next = taken;
+        }
+        mergedTail = taken;
       }
-      current = current->next;
     }
-    last = current;
-  } while (swapMade);
+    mergedTail->next = nullptr;
+    tail = mergedTail;
+  }
+}
+
+template <typename T>
+SinglyLinkedListNode<T>* SinglyLinkedList<T>::splitAfter(SinglyLinkedListNode<T>* first, int count) {
+  for (int i = 1; first != nullptr && i < count; i++) {
+    first = first->next;
+  }
+  if (first == nullptr) {
+    return nullptr;
+  }
+  SinglyLinkedListNode<T>* rest = first->next;
+  first->next = nullptr;
+  return rest;
 }
 
 template <typename T>
@@ -418,13 +590,24 @@ void SinglyLinkedList<T>::clear() {
   }
   size = 0; 
 	head = nullptr;
+	tail = nullptr;
 }
 
 template <typename T>
-void SinglyLinkedList<T>::swapData(SinglyLinkedListNode<T>*& a, SinglyLinkedListNode<T>*& b) {
-  T temp = a->data;
-  a->data = b->data;
-  b->data = temp;
+void SinglyLinkedList<T>::splice(SinglyLinkedList<T>& other) {
+  if (this == &other || other.head == nullptr) {
+    return;
+  }
+  if (tail == nullptr) {
+    head = other.head;
+  } else {
+    tail->next = other.head;
+  }
+  tail = other.tail;
+  size += other.size;
+  other.head = nullptr;
+  other.tail = nullptr;
+  other.size = 0;
 }
 
 template <typename T>
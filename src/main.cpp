@@ -1,23 +1,26 @@
 #include <ui.h>
 #include <fileParser.h>
 
-int main() {
+int main(int argc, char* argv[]) {
 	UI* ui = new UI();
+	if (!ui->parseArguments(argc, argv)) {
+		delete ui;
+		return 1;
+	}
 	ui->run();
 
 	Scheduler* scheduler = ui->getScheduler();
 	std::string filename = ui->getFilename();
 	FileParser* fileParser = new FileParser(filename);
-	fileParser->parseFile(filename);
-	
-	SinglyLinkedListNode<Process>* current = fileParser->getProcesses()->getHead();
-	while (current) {
-		Process currentProcess = current->getData();
-		Process* pProcess = &currentProcess;
-		scheduler->addProcess(pProcess); 
-		current = current->getNext();
+	fileParser->parseFileParallel(filename);
+	if (fileParser->getErrorCount() + fileParser->getWarningCount() > 0) {
+		fileParser->printDiagnostics(std::cerr);
 	}
+
+	scheduler->setDevices(fileParser->getCostModel());
+	scheduler->addProcesses(*fileParser->getProcesses());
 	scheduler->run();
+	ui->report();
 
 	delete ui;
 	delete fileParser;
@@ -0,0 +1,160 @@
+#include <nativeBackend.h>
+#include <chrono>
+#ifndef _WINDOWS32
+  #include <sched.h>
+  #include <signal.h>
+  #include <sys/resource.h>
+  #include <sys/types.h>
+  #include <sys/wait.h>
+  #include <unistd.h>
+#endif
+
+NativeBackend::NativeBackend(int newPinnedCpu) : jobsById(nullptr), jobsByIdSize(0), pinnedCpu(newPinnedCpu) {
+  jobs = new SinglyLinkedList<NativeJob>();
+  if (!jobs) {
+    throw std::runtime_error("Failed to allocate memory for native jobs list");
+  }
+}
+
+NativeBackend::~NativeBackend() {
+#ifndef _WINDOWS32
+  for (NativeJob& job : *jobs) {
+    if (!job.finished && job.pid > 0) {
+      killpg(job.pid, SIGKILL);
+      killpg(job.pid, SIGCONT);
+      waitpid(job.pid, nullptr, 0);
+    }
+  }
+#endif
+  delete jobs;
+  delete[] jobsById;
+}
+
+bool NativeBackend::isSupported() {
+#ifdef _WINDOWS32
+  return false;
+#else
+  return true;
+#endif
+}
+
+NativeJob* NativeBackend::findJob(unsigned long long processId) {
+  return processId < jobsByIdSize ? jobsById[processId] : nullptr;
+}
+
+NativeJob* NativeBackend::launch(const Process& process) {
+  unsigned long long processId = process.getId();
+  if (processId >= jobsByIdSize) {
+    // los identificadores son consecutivos, asi que duplicar el indice basta
+    unsigned long long newSize = jobsByIdSize * 2 > processId ? jobsByIdSize * 2 : processId + 1;
+    NativeJob** newJobsById = new NativeJob*[newSize]();
+    for (unsigned long long i = 0; i < jobsByIdSize; i++) {
+      newJobsById[i] = jobsById[i];
+    }
+    delete[] jobsById;
+    jobsById = newJobsById;
+    jobsByIdSize = newSize;
+  }
+  NativeJob* job = &jobs->emplaceTail();
+  jobsById[processId] = job;
+  job->name = process.getName();
+  job->processId = processId;
+  job->pid = -1;
+#ifndef _WINDOWS32
+  pid_t pid = fork();
+  if (pid < 0) {
+    std::cerr << "Error al crear el proceso hijo de " << process.getName() << std::endl;
+    job->finished = true;
+    job->exitStatus = -1;
+    return job;
+  }
+  if (pid == 0) {
+    // hijo: grupo propio para poder detener tambien a sus descendientes, CPU fijo, y espera detenido hasta su primer quantum
+    setpgid(0, 0);
+    if (pinnedCpu >= 0) {
+      cpu_set_t set;
+      CPU_ZERO(&set);
+      CPU_SET(pinnedCpu, &set);
+      sched_setaffinity(0, sizeof(set), &set);
+    }
+    raise(SIGSTOP);
+    execl("/bin/sh", "sh", "-c", process.getCommand().c_str(), (char*) nullptr);
+    _exit(127);
+  }
+  setpgid(pid, pid);
+  int status;
+  waitpid(pid, &status, WUNTRACED);
+  job->pid = pid;
+#else
+  job->finished = true;
+  job->exitStatus = -1;
+#endif
+  return job;
+}
+
+bool NativeBackend::runSlice(const Process& process, double seconds) {
+  NativeJob* job = findJob(process.getId());
+  if (!job) {
+    job = launch(process);
+  }
+  if (job->finished) {
+    return true;
+  }
+#ifndef _WINDOWS32
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  std::chrono::steady_clock::time_point deadline = start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(seconds));
+  int status = 0;
+  struct rusage usage;
+  bool exited = false;
+
+  job->slices++;
+  killpg(job->pid, SIGCONT);
+  while (true) {
+    pid_t result = wait4(job->pid, &status, WNOHANG, &usage);
+    if (result == job->pid && (WIFEXITED(status) || WIFSIGNALED(status))) {
+      exited = true;
+      break;
+    }
+    if (std::chrono::steady_clock::now() >= deadline) {
+      killpg(job->pid, SIGSTOP);
+      // el hijo pudo haber terminado justo antes de recibir la señal
+      result = wait4(job->pid, &status, WUNTRACED, &usage);
+      exited = result == job->pid && (WIFEXITED(status) || WIFSIGNALED(status));
+      break;
+    }
+    usleep(1000);
+  }
+  job->wallSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  if (exited) {
+    job->finished = true;
+    job->exitStatus = WIFEXITED(status) ? WEXITSTATUS(status) : -WTERMSIG(status);
+    job->userSeconds = usage.ru_utime.tv_sec + usage.ru_utime.tv_usec / 1e6;
+    job->systemSeconds = usage.ru_stime.tv_sec + usage.ru_stime.tv_usec / 1e6;
+  }
+  return exited;
+#else
+  return true;
+#endif
+}
+
+SinglyLinkedList<NativeJob>* NativeBackend::getJobs() {
+  return jobs;
+}
+
+void NativeBackend::printReport(std::ostream& os) {
+  os << "=== Ejecucion nativa ===" << std::endl;
+  for (const NativeJob& job : *jobs) {
+    os << job.name << ": pid " << job.pid
+      << ", CPU usuario " << job.userSeconds << " s"
+      << ", CPU sistema " << job.systemSeconds << " s"
+      << ", pared " << job.wallSeconds << " s"
+      << ", quantums " << job.slices;
+    if (job.finished) {
+      os << ", salida " << job.exitStatus;
+    } else {
+      os << ", sin terminar";
+    }
+    os << std::endl;
+  }
+}
@@ -1,4 +1,5 @@
 #include <process.h>
+#include <utility>
 
 std::ostream& operator<<(std::ostream& os, const ProcessState& state) {
   switch (state) {
@@ -25,27 +26,21 @@ std::ostream& operator<<(std::ostream& os, const ProcessState& state) {
 }
 
 Process::Process() 
-  : name("null"), priority(0), instructionIndex(1), remainingQuantum(5), IOPending(false) {
-  instructions = new SinglyLinkedList<std::string>();
-  if (!instructions) {
-    throw std::runtime_error("Failed to allocate memory for instructions list");
-  }
+  : name("null"), priority(0), program(Program::empty()), instructionIndex(1), remainingQuantum(5), IOPending(false),
+    deadline(0), period(0), affinity(-1), id(0), times{0, 0, 0, 0, false, 0, 0, -1, -1, -1} {
   state = ProcessState::READY;
 }
 
 Process::Process(const std::string newName, int newPriority) 
-  : name(newName), priority(newPriority),
-    instructionIndex(1), remainingQuantum(5), IOPending(false) {
-  instructions = new SinglyLinkedList<std::string>();
-  if (!instructions) {
-    throw std::runtime_error("Failed to allocate memory for instructions list");
-  }
+  : name(newName), priority(newPriority), program(Program::empty()),
+    instructionIndex(1), remainingQuantum(5), IOPending(false),
+    deadline(0), period(0), affinity(-1), id(0), times{0, 0, 0, 0, false, 0, 0, -1, -1, -1} {
   state = ProcessState::READY;
 }
 
 Process::Process(const Process& other) : name(other.name), priority(other.priority), 
-	state(other.state), instructionIndex(other.instructionIndex), remainingQuantum(other.remainingQuantum), IOPending(other.IOPending) {
-	instructions = new SinglyLinkedList<std::string>(*other.instructions);
+	program(other.program->retain()), state(other.state), instructionIndex(other.instructionIndex), remainingQuantum(other.remainingQuantum), IOPending(other.IOPending), command(other.command),
+	deadline(other.deadline), period(other.period), group(other.group), affinity(other.affinity), id(other.id), times(other.times) {
 }
 
 Process& Process::operator=(const Process& other) {
@@ -55,15 +50,52 @@ Process& Process::operator=(const Process& other) {
 		instructionIndex = other.instructionIndex;
 		remainingQuantum = other.remainingQuantum;
 		IOPending = other.IOPending;
+		command = other.command;
+		deadline = other.deadline;
+		period = other.period;
+		group = other.group;
+		affinity = other.affinity;
+		id = other.id;
+		times = other.times;
 		state = other.state;
-		delete instructions;
-		instructions = new SinglyLinkedList<std::string>(*other.instructions);
+		// se toma la referencia nueva antes de soltar la vieja, por si ambos procesos ya compartian el programa
+		Program* oldProgram = program;
+		program = other.program->retain();
+		oldProgram->release();
+	}
+	return *this;
+}
+
+Process::Process(Process&& other) noexcept : name(std::move(other.name)), priority(other.priority),
+	program(other.program), state(other.state), instructionIndex(other.instructionIndex), remainingQuantum(other.remainingQuantum),
+	IOPending(other.IOPending), command(std::move(other.command)), deadline(other.deadline), period(other.period),
+	group(std::move(other.group)), affinity(other.affinity), id(other.id), times(other.times) {
+	other.program = Program::empty();
+}
+
+Process& Process::operator=(Process&& other) noexcept {
+	if (this != &other) {
+		name = std::move(other.name);
+		priority = other.priority;
+		instructionIndex = other.instructionIndex;
+		remainingQuantum = other.remainingQuantum;
+		IOPending = other.IOPending;
+		command = std::move(other.command);
+		deadline = other.deadline;
+		period = other.period;
+		group = std::move(other.group);
+		affinity = other.affinity;
+		id = other.id;
+		times = other.times;
+		state = other.state;
+		// el otro proceso se queda con el programa viejo de este y lo suelta al destruirse
+		std::swap(program, other.program);
 	}
 	return *this;
 }
 
 Process::~Process() {
-  delete instructions;
+  program->release();
 }
 
 const std::string Process::getName() const {
@@ -94,37 +126,142 @@ int Process::getInstructionIndex() const {
 	return instructionIndex;
 }
 
-float Process::getQuantum() const {
+double Process::getQuantum() const {
   return remainingQuantum;
 }
 
-void Process::setQuantum(float newQuantum) {
+void Process::setQuantum(double newQuantum) {
   remainingQuantum = newQuantum;
 }
 
-SinglyLinkedList<std::string>* Process::getInstructions() const {
-	return instructions;
+bool Process::fitsInQuantum(double cost) const {
+  return cost <= remainingQuantum + Program::COST_TOLERANCE;
+}
+
+bool Process::isQuantumExhausted() const {
+  return remainingQuantum <= Program::COST_TOLERANCE;
 }
 
-void Process::addInstruction(const std::string instruction) {
-  instructions->insertTail(instruction);
+int Process::getInstructionCount() const {
+	return program->getCount();
+}
+
+int Process::getInstructionId(int index) const {
+	return program->getId(index);
+}
+
+const std::string* Process::getInstruction(int index) const {
+	int id = getInstructionId(index);
+	return id < 0 ? nullptr : &InstructionDictionary::getText(id);
+}
+
+const int* Process::getInstructionIds() const {
+	return program->getIds();
+}
+
+const Program* Process::getProgram() const {
+	return program;
+}
+
+double Process::getInstructionCost(int index) const {
+	return program->getCost(index);
+}
+
+int Process::getIODevice() const {
+	// startIO ya avanzo el indice: la operacion en curso empezo en la instruccion anterior
+	return program->getDevice(instructionIndex - 1);
+}
+
+ProcessTimes& Process::getTimes() {
+	return times;
+}
+
+const ProcessTimes& Process::getTimes() const {
+	return times;
+}
+
+const std::string& Process::getCommand() const {
+	return command;
+}
+
+void Process::setCommand(const std::string& newCommand) {
+	command = newCommand;
+}
+
+bool Process::hasCommand() const {
+	return !command.empty();
+}
+
+double Process::getDeadline() const {
+	return deadline > 0 ? deadline : period;
+}
+
+void Process::setDeadline(double newDeadline) {
+	deadline = newDeadline > 0 ? newDeadline : 0;
+}
+
+double Process::getPeriod() const {
+	return period;
+}
+
+void Process::setPeriod(double newPeriod) {
+	period = newPeriod > 0 ? newPeriod : 0;
+}
+
+const std::string& Process::getGroup() const {
+	return group;
+}
+
+void Process::setGroup(const std::string& newGroup) {
+	group = newGroup;
+}
+
+int Process::getAffinity() const {
+	return affinity;
+}
+
+void Process::setAffinity(int newAffinity) {
+	affinity = newAffinity >= 0 ? newAffinity : -1;
+}
+
+unsigned long long Process::getId() const {
+	return id;
+}
+
+void Process::setId(unsigned long long newId) {
+	id = newId;
+}
+
+void Process::addInstruction(const std::string& instruction) {
+  addInstruction(InstructionDictionary::intern(instruction));
+}
+
+void Process::addInstruction(int instructionId) {
+  addInstruction(instructionId, CostModel::getDefaultCost(instructionId));
+}
+
+void Process::addInstruction(int instructionId, double cost, int device) {
+  // copy-on-write: las otras copias del proceso siguen viendo el programa original
+  if (program->isShared()) {
+    Program* privateProgram = program->clone();
+    program->release();
+    program = privateProgram;
+  }
+  program->append(instructionId, cost, device);
 }
 
 bool Process::executeNextInstruction() {
-  if (!instructions || state == ProcessState::FINISHED) {
+  if (state == ProcessState::FINISHED) {
     return false;
   }
-  if (remainingQuantum <= 0) {
+  if (isQuantumExhausted()) {
     state = ProcessState::RUNNING_PREEMPTED;
     return false;
   }
   if (this->hasMoreInstrucions()) {
-    SinglyLinkedListNode<std::string>* node = instructions->getAt(instructionIndex);
-    if (!node) {
-      return false;
-    }
-    if (node->getData() == "e/s") {
-      if (remainingQuantum >= 1.5) {
+    double cost = program->getCost(instructionIndex);
+    if (program->getId(instructionIndex) == InstructionDictionary::IO) {
+      if (fitsInQuantum(cost)) {
         if (IOPending) {
           finishIO();
           return true;
@@ -135,10 +272,14 @@ bool Process::executeNextInstruction() {
       }
       return false;
     }
-    sleepInSeconds(1);
-    remainingQuantum--;
+    if (!fitsInQuantum(cost)) {
+      state = ProcessState::RUNNING_PREEMPTED;
+      return false;
+    }
+    sleepInSeconds(cost);
+    remainingQuantum -= cost;
     instructionIndex++;
-    if (instructionIndex > instructions->getSize()) {
+    if (instructionIndex > program->getCount()) {
       state = ProcessState::FINISHED;
     }
     return true;
@@ -146,8 +287,27 @@ bool Process::executeNextInstruction() {
   return false;
 }
 
+int Process::executeBurst() {
+  if (state == ProcessState::FINISHED || isQuantumExhausted()) {
+    return 0;
+  }
+  int burstEnd = program->findBurstEnd(instructionIndex, remainingQuantum);
+  int executed = burstEnd - instructionIndex;
+  if (executed == 0) {
+    return 0;
+  }
+  double cost = program->getCostBetween(instructionIndex, burstEnd);
+  sleepInSeconds(cost);
+  remainingQuantum -= cost;
+  instructionIndex = burstEnd;
+  if (instructionIndex > program->getCount()) {
+    state = ProcessState::FINISHED;
+  }
+  return executed;
+}
+
 bool Process::hasMoreInstrucions() const {
-  return instructionIndex <= instructions->getSize();
+  return instructionIndex <= program->getCount();
 }
 void Process::resetExecution() {
   instructionIndex = 1;
@@ -156,6 +316,18 @@ void Process::resetExecution() {
   state = ProcessState::READY;
 }
 
+int Process::countIOInstructions(int fromIndex) const {
+	return program->countIOInstructions(fromIndex);
+}
+
+int Process::countCPUInstructions(int fromIndex) const {
+	return program->countCPUInstructions(fromIndex);
+}
+
+int Process::projectPriority(int basePriority, int fromIndex) const {
+	return program->projectPriority(basePriority, fromIndex);
+}
+
 bool Process::isInIO() const {
   return IOPending;
 }
@@ -163,16 +335,18 @@ bool Process::isInIO() const {
 void Process::startIO() {
   IOPending = true;
   state = ProcessState::BLOCKED;
-  sleepInSeconds(1.5);
-  remainingQuantum -= 1.5;
+  double cost = program->getCost(instructionIndex);
+  sleepInSeconds(cost);
+  remainingQuantum -= cost;
   instructionIndex++;
 }
 
 void Process::finishIO() {
   IOPending = false;
   state = ProcessState::READY;
-  sleepInSeconds(1.5);
-  remainingQuantum -= 1.5;
+  double cost = program->getCost(instructionIndex);
+  sleepInSeconds(cost);
+  remainingQuantum -= cost;
   instructionIndex++;
 }
 
@@ -185,11 +359,7 @@ bool Process::operator>(const Process& other) {
 } 
 
 void Process::sleepInSeconds(float seconds) {
-#ifdef _WINDOWS32
-  Sleep(seconds * 1000);
-#else
-  sleep(seconds);
-#endif
+  SimulationClock::advance(seconds);
 }
 
 bool Process::operator<(const Process& other) const {
@@ -207,6 +377,9 @@ bool Process::operator==(const Process& other) const {
 	if (this == &other) {
 		return true;
 	}
+	if (this->id != 0 && other.id != 0) {
+		return this->id == other.id;
+	}
 	return this->priority == other.priority && this->name == other.name;
 }
 
@@ -232,17 +405,11 @@ std::ostream& operator<<(std::ostream& os, const Process& process) {
 			<< ", IO pending: " << (process.isInIO() ? "true" : "false")
 			<< ", instructions: {";
 	
-	SinglyLinkedList<std::string>* instructions = process.getInstructions();
-	if (instructions) {
-		for (int i = 1; i <= instructions->getSize(); i++) {
-			if (i > 1) {
-				os << ", ";
-			}
-			SinglyLinkedListNode<std::string>* node = instructions->getAt(i);
-			if (node) {
-				os << node->getData();
-				}
+	for (int index = 1; index <= process.getInstructionCount(); index++) {
+		if (index > 1) {
+			os << ", ";
 		}
+		os << *process.getInstruction(index);
 	}
 	os << "}]";
 	
@@ -0,0 +1,228 @@
+#include <profiler.h>
+#include <fstream>
+#ifdef SCHEDULER_PROFILING
+  #include <cstring>
+  #if defined(__linux__)
+    #include <linux/perf_event.h>
+    #include <sys/ioctl.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+  #endif
+#endif
+
+const char* Profiler::phaseName(ProfilePhase phase) {
+  switch (phase) {
+    case ProfilePhase::SELECT_NEXT_PROCESS:
+      return "selectNextProcess";
+    case ProfilePhase::EXECUTE_QUANTUM:
+      return "executeQuantum";
+    case ProfilePhase::CHECK_BLOCKED_PROCESSES:
+      return "checkBlockedProcesses";
+    case ProfilePhase::MOVE_TO_READY:
+      return "moveToReady";
+    case ProfilePhase::MOVE_TO_BLOCKED:
+      return "moveToBlocked";
+    case ProfilePhase::MOVE_TO_FINISHED:
+      return "moveToFinished";
+    default:
+      return "unknown";
+  }
+}
+
+#ifdef SCHEDULER_PROFILING
+
+/// @brief Estadisticas acumuladas de una fase.
+struct PhaseStats {
+  unsigned long long calls;
+  unsigned long long totalNanoseconds;
+  unsigned long long minNanoseconds;
+  unsigned long long maxNanoseconds;
+  unsigned long long counters[3];
+  unsigned long long histogram[Profiler::HISTOGRAM_BUCKETS];
+};
+
+/// @brief Un intervalo registrado para el trace de Chrome.
+struct TraceEvent {
+  ProfilePhase phase;
+  unsigned long long startNanoseconds;
+  unsigned long long durationNanoseconds;
+};
+
+static PhaseStats phaseStats[(int) ProfilePhase::COUNT];
+static TraceEvent* traceEvents = nullptr;
+static int traceSize = 0;
+static unsigned long long droppedEvents = 0;
+static std::chrono::steady_clock::time_point profileEpoch = std::chrono::steady_clock::now();
+static int perfGroupFd = -1;
+static const char* counterNames[3] = {"cycles", "instructions", "cache misses"};
+
+bool Profiler::isEnabled() {
+  return true;
+}
+
+bool Profiler::enablePerfCounters() {
+#if defined(__linux__)
+  if (perfGroupFd >= 0) {
+    return true;
+  }
+  unsigned long long configs[3] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES};
+  int fds[3] = {-1, -1, -1};
+  for (int i = 0; i < 3; i++) {
+    struct perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = configs[i];
+    attr.disabled = i == 0 ? 1 : 0;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP;
+    fds[i] = syscall(__NR_perf_event_open, &attr, 0, -1, i == 0 ? -1 : fds[0], 0);
+    if (fds[i] < 0) {
+      for (int j = 0; j < i; j++) {
+        close(fds[j]);
+      }
+      std::cerr << "perf_event_open no esta disponible; se perfila sin contadores de hardware" << std::endl;
+      return false;
+    }
+  }
+  perfGroupFd = fds[0];
+  ioctl(perfGroupFd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+  ioctl(perfGroupFd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+  return true;
+#else
+  return false;
+#endif
+}
+
+void Profiler::readCounters(unsigned long long values[3]) {
+  values[0] = values[1] = values[2] = 0;
+#if defined(__linux__)
+  if (perfGroupFd < 0) {
+    return;
+  }
+  // con PERF_FORMAT_GROUP se lee {cantidad, valor0, valor1, valor2}
+  unsigned long long buffer[4];
+  if (read(perfGroupFd, buffer, sizeof(buffer)) == (ssize_t) sizeof(buffer)) {
+    values[0] = buffer[1];
+    values[1] = buffer[2];
+    values[2] = buffer[3];
+  }
+#endif
+}
+
+void Profiler::record(ProfilePhase phase, std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end,
+  const unsigned long long startCounters[3], const unsigned long long endCounters[3]) {
+  unsigned long long duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+  PhaseStats& stats = phaseStats[(int) phase];
+  if (stats.calls == 0 || duration < stats.minNanoseconds) {
+    stats.minNanoseconds = duration;
+  }
+  if (duration > stats.maxNanoseconds) {
+    stats.maxNanoseconds = duration;
+  }
+  stats.calls++;
+  stats.totalNanoseconds += duration;
+  for (int i = 0; i < 3; i++) {
+    stats.counters[i] += endCounters[i] - startCounters[i];
+  }
+  int bucket = 0;
+  while (bucket < HISTOGRAM_BUCKETS - 1 && (duration >> (bucket + 1)) != 0) {
+    bucket++;
+  }
+  stats.histogram[bucket]++;
+
+  if (!traceEvents) {
+    traceEvents = new TraceEvent[TRACE_CAPACITY];
+  }
+  if (traceSize < TRACE_CAPACITY) {
+    unsigned long long startOffset = std::chrono::duration_cast<std::chrono::nanoseconds>(start - profileEpoch).count();
+    traceEvents[traceSize++] = TraceEvent{phase, startOffset, duration};
+  } else {
+    droppedEvents++;
+  }
+}
+
+void Profiler::reset() {
+  std::memset(phaseStats, 0, sizeof(phaseStats));
+  traceSize = 0;
+  droppedEvents = 0;
+  profileEpoch = std::chrono::steady_clock::now();
+}
+
+void Profiler::printSummary(std::ostream& os) {
+  os << "=== Perfil del planificador ===" << std::endl;
+  for (int p = 0; p < (int) ProfilePhase::COUNT; p++) {
+    const PhaseStats& stats = phaseStats[p];
+    if (stats.calls == 0) {
+      continue;
+    }
+    os << phaseName((ProfilePhase) p) << ": " << stats.calls << " llamadas"
+      << ", total " << stats.totalNanoseconds / 1000.0 << " us"
+      << ", promedio " << (double) stats.totalNanoseconds / stats.calls << " ns"
+      << ", min " << stats.minNanoseconds << " ns"
+      << ", max " << stats.maxNanoseconds << " ns" << std::endl;
+    if (perfGroupFd >= 0) {
+      os << "  ";
+      for (int i = 0; i < 3; i++) {
+        os << counterNames[i] << ": " << (double) stats.counters[i] / stats.calls << "/llamada  ";
+      }
+      os << std::endl;
+    }
+    unsigned long long peak = 0;
+    for (int b = 0; b < HISTOGRAM_BUCKETS; b++) {
+      peak = stats.histogram[b] > peak ? stats.histogram[b] : peak;
+    }
+    for (int b = 0; b < HISTOGRAM_BUCKETS; b++) {
+      if (stats.histogram[b] == 0) {
+        continue;
+      }
+      int width = (int) (40 * stats.histogram[b] / peak);
+      os << "  [" << (1ULL << b) << " ns, " << (1ULL << (b + 1)) << " ns) " << std::string(width > 0 ? width : 1, '#')
+        << " " << stats.histogram[b] << std::endl;
+    }
+  }
+  if (droppedEvents > 0) {
+    os << "Intervalos fuera del trace por falta de espacio: " << droppedEvents << std::endl;
+  }
+}
+
+bool Profiler::writeChromeTrace(const std::string& filename) {
+  std::ofstream file(filename);
+  if (!file.is_open()) {
+    std::cerr << "Error al abrir el archivo de trace " << filename << std::endl;
+    return false;
+  }
+  file << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+  for (int i = 0; i < traceSize; i++) {
+    const TraceEvent& event = traceEvents[i];
+    file << (i > 0 ? ",\n" : "\n")
+      << "{\"name\":\"" << phaseName(event.phase) << "\",\"cat\":\"scheduler\",\"ph\":\"X\",\"pid\":1,\"tid\":1"
+      << ",\"ts\":" << event.startNanoseconds / 1000.0 << ",\"dur\":" << event.durationNanoseconds / 1000.0 << "}";
+  }
+  file << "\n]}" << std::endl;
+  return true;
+}
+
+#else
+
+bool Profiler::isEnabled() {
+  return false;
+}
+
+bool Profiler::enablePerfCounters() {
+  return false;
+}
+
+void Profiler::reset() {}
+
+void Profiler::printSummary(std::ostream& os) {
+  os << "Perfilado no compilado; recompile con make PROFILE=1" << std::endl;
+}
+
+bool Profiler::writeChromeTrace(const std::string& filename) {
+  std::cerr << "Perfilado no compilado; recompile con make PROFILE=1" << std::endl;
+  return false;
+}
+
+#endif
@@ -0,0 +1,225 @@
+#include <program.h>
+#include <algorithm>
+#include <climits>
+#include <cstring>
+
+// cotas "infinitas" para los pasos que solo saturan por un lado; quedan lejos de INT_MIN/INT_MAX para poder sumarles desplazamientos
+static const int UNBOUNDED_FLOOR = INT_MIN / 4;
+static const int UNBOUNDED_CEILING = INT_MAX / 4;
+
+static int clampInt(int value, int floor, int ceiling) {
+  return std::min(ceiling, std::max(floor, value));
+}
+
+Program::Program() : references(1), instructions(nullptr), costs(nullptr), devices(nullptr), count(0), capacity(0),
+  ioPrefix(nullptr), priorityTransforms(nullptr), costPrefix(nullptr), nextIO(nullptr), profileSize(-1) {}
+
+Program::~Program() {
+  delete[] instructions;
+  delete[] costs;
+  delete[] devices;
+  clearProfile();
+}
+
+Program* Program::create() {
+  return new Program();
+}
+
+Program* Program::empty() {
+  // se crea una sola vez, con su perfil ya construido, y nunca se libera: siempre esta compartido y nadie lo modifica
+  static Program* emptyProgram = [] {
+    Program* program = create();
+    program->buildProfile();
+    return program;
+  }();
+  return emptyProgram->retain();
+}
+
+Program* Program::clone() const {
+  Program* copy = new Program();
+  copy->count = count;
+  copy->capacity = count;
+  if (count > 0) {
+    copy->instructions = new int[count];
+    std::memcpy(copy->instructions, instructions, sizeof(int) * count);
+    copy->costs = new double[count];
+    std::memcpy(copy->costs, costs, sizeof(double) * count);
+    copy->devices = new int[count];
+    std::memcpy(copy->devices, devices, sizeof(int) * count);
+  }
+  if (profileSize >= 0) {
+    copy->profileSize = profileSize;
+    copy->ioPrefix = new int[profileSize + 1];
+    std::memcpy(copy->ioPrefix, ioPrefix, sizeof(int) * (profileSize + 1));
+    copy->priorityTransforms = new PriorityTransform[profileSize + 2];
+    std::memcpy(copy->priorityTransforms, priorityTransforms, sizeof(PriorityTransform) * (profileSize + 2));
+    copy->costPrefix = new double[profileSize + 1];
+    std::memcpy(copy->costPrefix, costPrefix, sizeof(double) * (profileSize + 1));
+    copy->nextIO = new int[profileSize + 2];
+    std::memcpy(copy->nextIO, nextIO, sizeof(int) * (profileSize + 2));
+  }
+  return copy;
+}
+
+Program* Program::retain() {
+  buildProfile();
+  references.fetch_add(1, std::memory_order_relaxed);
+  return this;
+}
+
+void Program::release() {
+  if (references.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    delete this;
+  }
+}
+
+bool Program::isShared() const {
+  return references.load(std::memory_order_acquire) > 1;
+}
+
+void Program::append(int instructionId, double cost, int device) {
+  if (count == capacity) {
+    int newCapacity = capacity == 0 ? 8 : capacity * 2;
+    int* newInstructions = new int[newCapacity];
+    double* newCosts = new double[newCapacity];
+    int* newDevices = new int[newCapacity];
+    if (count > 0) {
+      std::memcpy(newInstructions, instructions, sizeof(int) * count);
+      std::memcpy(newCosts, costs, sizeof(double) * count);
+      std::memcpy(newDevices, devices, sizeof(int) * count);
+    }
+    delete[] instructions;
+    delete[] costs;
+    delete[] devices;
+    instructions = newInstructions;
+    costs = newCosts;
+    devices = newDevices;
+    capacity = newCapacity;
+  }
+  instructions[count] = instructionId;
+  costs[count] = cost;
+  devices[count] = device;
+  count++;
+}
+
+int Program::getCount() const {
+  return count;
+}
+
+int Program::getId(int index) const {
+  if (index < 1 || index > count) {
+    return -1;
+  }
+  return instructions[index - 1];
+}
+
+const int* Program::getIds() const {
+  return instructions;
+}
+
+double Program::getCost(int index) const {
+  if (index < 1 || index > count) {
+    return 0;
+  }
+  return costs[index - 1];
+}
+
+int Program::getDevice(int index) const {
+  if (index < 1 || index > count) {
+    return CostModel::DEFAULT_DEVICE;
+  }
+  return devices[index - 1];
+}
+
+void Program::buildProfile() const {
+  int size = count;
+  if (profileSize == size) {
+    return;
+  }
+  clearProfile();
+  ioPrefix = new int[size + 1];
+  priorityTransforms = new PriorityTransform[size + 2];
+  costPrefix = new double[size + 1];
+  nextIO = new int[size + 2];
+
+  ioPrefix[0] = 0;
+  costPrefix[0] = 0;
+  int index;
+  for (index = 1; index <= size; index++) {
+    ioPrefix[index] = ioPrefix[index - 1] + (instructions[index - 1] == InstructionDictionary::IO ? 1 : 0);
+    costPrefix[index] = costPrefix[index - 1] + costs[index - 1];
+  }
+  nextIO[size + 1] = size + 1;
+  for (index = size; index >= 1; index--) {
+    nextIO[index] = instructions[index - 1] == InstructionDictionary::IO ? index : nextIO[index + 1];
+  }
+
+  // se compone de atras hacia adelante: el efecto de i..n es el paso i seguido del efecto de i+1..n
+  priorityTransforms[size + 1] = {0, UNBOUNDED_FLOOR, UNBOUNDED_CEILING};
+  for (index = size; index >= 1; index--) {
+    bool isIO = ioPrefix[index] != ioPrefix[index - 1];
+    PriorityTransform step = isIO ? PriorityTransform{-1, MIN_PRIORITY, UNBOUNDED_CEILING}
+      : PriorityTransform{1, UNBOUNDED_FLOOR, MAX_PRIORITY};
+    const PriorityTransform& rest = priorityTransforms[index + 1];
+    priorityTransforms[index].shift = step.shift + rest.shift;
+    priorityTransforms[index].floor = clampInt(step.floor + rest.shift, rest.floor, rest.ceiling);
+    priorityTransforms[index].ceiling = clampInt(step.ceiling + rest.shift, rest.floor, rest.ceiling);
+  }
+  profileSize = size;
+}
+
+void Program::clearProfile() const {
+  delete[] ioPrefix;
+  ioPrefix = nullptr;
+  delete[] priorityTransforms;
+  priorityTransforms = nullptr;
+  delete[] costPrefix;
+  costPrefix = nullptr;
+  delete[] nextIO;
+  nextIO = nullptr;
+  profileSize = -1;
+}
+
+int Program::countIOInstructions(int fromIndex) const {
+  buildProfile();
+  fromIndex = clampInt(fromIndex, 1, profileSize + 1);
+  return ioPrefix[profileSize] - ioPrefix[fromIndex - 1];
+}
+
+int Program::countCPUInstructions(int fromIndex) const {
+  buildProfile();
+  fromIndex = clampInt(fromIndex, 1, profileSize + 1);
+  return (profileSize - fromIndex + 1) - countIOInstructions(fromIndex);
+}
+
+int Program::projectPriority(int basePriority, int fromIndex) const {
+  buildProfile();
+  fromIndex = clampInt(fromIndex, 1, profileSize + 1);
+  const PriorityTransform& transform = priorityTransforms[fromIndex];
+  return clampInt(basePriority + transform.shift, transform.floor, transform.ceiling);
+}
+
+int Program::findBurstEnd(int fromIndex, double quantum) const {
+  buildProfile();
+  fromIndex = clampInt(fromIndex, 1, profileSize + 1);
+  // la rafaga no pasa de la siguiente E/S; dentro de ella el costo acumulado crece, asi que se busca el limite con busqueda binaria
+  int low = fromIndex;
+  int high = nextIO[fromIndex];
+  double budget = costPrefix[fromIndex - 1] + quantum + COST_TOLERANCE;
+  while (low < high) {
+    int middle = low + (high - low) / 2;
+    if (costPrefix[middle] <= budget) {
+      low = middle + 1;
+    } else {
+      high = middle;
+    }
+  }
+  return low;
+}
+
+double Program::getCostBetween(int fromIndex, int toIndex) const {
+  buildProfile();
+  fromIndex = clampInt(fromIndex, 1, profileSize + 1);
+  toIndex = clampInt(toIndex, fromIndex, profileSize + 1);
+  return costPrefix[toIndex - 1] - costPrefix[fromIndex - 1];
+}
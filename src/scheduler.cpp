@@ -1,47 +1,141 @@
+#include <profiler.h>
 #include <scheduler.h>
+#include <cstring>
+#include <chrono>
 #include <ui.h>
 
-Scheduler::Scheduler() : currentProcess(nullptr) {
-	readyQueue = new SinglyLinkedList<Process>();
-	blockedQueue = new SinglyLinkedList<Process>();
+Scheduler::Scheduler() : currentProcess(nullptr), devices(nullptr), deviceCount(0), acceptingSubmissions(false), submissionsInFlight(0), nativeBackend(nullptr),
+	startTime(SimulationClock::now()), instructionTrace(true), seed(0), eventTrace(nullptr), timeline(nullptr),
+	switchCost(0), warmupCost(0), stickyEqualPriority(false), switchCount(0), switchOverhead(0),
+	lastDispatched(new unsigned long long[1]{0}), nextProcessId(1), cpuCount(1), cpuBusy(new double[1]{0}), migrations(0), migrationsWithoutAffinity(0),
+	statusServer(nullptr), statusCount(0), statusLatencies(), statusRefreshedAt(), dynamicDispatch(false) {
 	finishedProcesses = new SinglyLinkedList<Process>();
-	ioTimer = new Timer(15);
+	setDevices(CostModel());
+	submissionQueue = new MPSCQueue<Process>();
+	waitingHistogram = new LatencyHistogram();
+	responseHistogram = new LatencyHistogram();
+	blockedHistogram = new LatencyHistogram();
+	latenessHistogram = new LatencyHistogram();
+	deadlineCount = 0;
+	deadlineMisses = 0;
 }
 
 Scheduler::~Scheduler() {
-	delete readyQueue;
-	readyQueue = nullptr;
-	delete blockedQueue;
-	blockedQueue = nullptr;
 	delete finishedProcesses;
 	finishedProcesses = nullptr;
 	delete currentProcess;
 	currentProcess = nullptr;
-	delete ioTimer;
-	readyQueue = nullptr;
+	clearDevices();
+	delete submissionQueue;
+	submissionQueue = nullptr;
+	delete nativeBackend;
+	nativeBackend = nullptr;
+	delete waitingHistogram;
+	waitingHistogram = nullptr;
+	delete responseHistogram;
+	responseHistogram = nullptr;
+	delete blockedHistogram;
+	blockedHistogram = nullptr;
+	delete latenessHistogram;
+	latenessHistogram = nullptr;
+	delete timeline;
+	timeline = nullptr;
+	delete[] lastDispatched;
+	lastDispatched = nullptr;
+	delete[] cpuBusy;
+	cpuBusy = nullptr;
+	delete statusServer;
+	statusServer = nullptr;
 }
 
 void Scheduler::run() {
-	while (hasUnfinishedProcesses()) {
-		checkBlockedProcesses();
-		executeQuantum();
-		schedule();
-		displayStatus();
+	if (cpuCount > 1) {
+		runMultiCore();
+	} else {
+		runLoop();
+	}
+	if (timeline) {
+		timeline->close(now());
+	}
+	publishStatus(true);
+	printLatencyReport(std::cout);
+	printDeviceReport(std::cout);
+	printSwitchReport(std::cout);
+	if (cpuCount > 1) {
+		printCpuReport(std::cout);
+	}
+	if (deadlineCount > 0) {
+		printDeadlineReport(std::cout);
+	}
+	if (nativeBackend) {
+		nativeBackend->printReport(std::cout);
+	}
+}
+
+void Scheduler::runLoop() {
+	runLoopWith(*this);
+}
+
+void Scheduler::addProcesses(const SinglyLinkedList<Process>& processes) {
+	for (const Process& process : processes) {
+		Process newProcess = process;
+		addProcess(&newProcess);
+	}
+}
+
+void Scheduler::submitProcess(const Process& newProcess) {
+	// el contador cubre el momento en que el push ya empezo pero el nodo todavia no se ve desde la cola
+	submissionsInFlight.fetch_add(1);
+	submissionQueue->push(newProcess);
+	submissionsInFlight.fetch_sub(1);
+	submissionSignal.notify_one();
+}
+
+int Scheduler::admitSubmittedProcesses() {
+	int admitted = 0;
+	Process submitted;
+	while (submissionQueue->tryPop(submitted)) {
+		addProcess(&submitted);
+		admitted++;
 	}
+	return admitted;
 }
 
-void Scheduler::addProcess(Process* newProcess) {
-	readyQueue->insertTail(*newProcess);
+void Scheduler::openSubmissions() {
+	acceptingSubmissions.store(true);
+}
+
+void Scheduler::closeSubmissions() {
+	acceptingSubmissions.store(false);
+	submissionSignal.notify_one();
+}
+
+bool Scheduler::hasPendingSubmissions() const {
+	// en este orden: un envio que empezo antes del cierre sigue contado en submissionsInFlight o ya esta en la cola
+	return acceptingSubmissions.load() || submissionsInFlight.load() > 0 || !submissionQueue->isEmpty();
+}
+
+void Scheduler::waitForSubmissions() {
+	std::unique_lock<std::mutex> lock(submissionMutex);
+	submissionSignal.wait_for(lock, std::chrono::milliseconds(5), [this]() {
+		return !submissionQueue->isEmpty() || !hasPendingSubmissions();
+	});
 }
 
 void Scheduler::removeProcess(Process* process) {
 	switch(process->getState()) {
 		case ProcessState::READY:
-			readyQueue->deleteByValue(*process);
+			removeReady(*process);
 			break;
-		case ProcessState::BLOCKED:
-			blockedQueue->deleteByValue(*process);
+		case ProcessState::BLOCKED: {
+			double current = now();
+			for (int index = 0; index < deviceCount; index++) {
+				if (devices[index]->remove(*process, current)) {
+					break;
+				}
+			}
 			break;
+		}
 		case ProcessState::FINISHED:
 			finishedProcesses->deleteByValue(*process);
 			break;
@@ -51,43 +145,166 @@ void Scheduler::removeProcess(Process* process) {
 }
 
 void Scheduler::schedule() {
-	selectNextProcess();
-	
+	{
+		PROFILE_SCOPE(ProfilePhase::SELECT_NEXT_PROCESS);
+		selectNextProcess();
+	}
+	startCurrentProcess();
+}
+
+void Scheduler::startCurrentProcess() {
 	if (currentProcess) {
+		chargeContextSwitch();
+		noteDispatch(*currentProcess);
 		currentProcess->setState(ProcessState::RUNNING_ACTIVE);
 	}
 }
 
-void Scheduler::executeQuantum() {
-	if (!currentProcess) {
-		return;
+int Scheduler::fillRound(Process** assigned) {
+	// procesos de la ronda en el orden del algoritmo; los de un grupo quedan juntos
+	Process* picks = new Process[cpuCount];
+	int pickCount = 0;
+	while (pickCount < cpuCount && popReady(picks[pickCount])) {
+		std::string group = picks[pickCount++].getGroup();
+		while (!group.empty() && pickCount < cpuCount && takeReady(group, picks[pickCount])) {
+			pickCount++;
+		}
 	}
 
-	while (currentProcess->getInstructions()->getSize() >= currentProcess->getInstructionIndex()) {
-		std::string	currentInstruction = currentProcess->getInstructions()->getAt(currentProcess->getInstructionIndex())->getData();
-		double quantumCost = (currentInstruction == "e/s") ? 1.5 : 1;
+	// primero cada proceso en su CPU preferido (o en el ultimo en que corrio), si esta libre; luego los demas en los CPUs que queden
+	for (int cpu = 0; cpu < cpuCount; cpu++) {
+		assigned[cpu] = nullptr;
+	}
+	bool* placed = new bool[pickCount];
+	// pickOf[cpu]: posicion en la ronda del proceso que quedo en ese CPU
+	int* pickOf = new int[cpuCount];
+	for (int pick = 0; pick < pickCount; pick++) {
+		int preferred = picks[pick].getAffinity() >= 0 ? picks[pick].getAffinity() : picks[pick].getTimes().lastCpu;
+		placed[pick] = preferred >= 0 && preferred < cpuCount && !assigned[preferred];
+		if (placed[pick]) {
+			assigned[preferred] = new Process(std::move(picks[pick]));
+			pickOf[preferred] = pick;
+		}
+	}
+	int freeCpu = 0;
+	for (int pick = 0; pick < pickCount; pick++) {
+		if (!placed[pick]) {
+			while (assigned[freeCpu]) {
+				freeCpu++;
+			}
+			assigned[freeCpu] = new Process(std::move(picks[pick]));
+			pickOf[freeCpu] = pick;
+		}
+	}
+	delete[] placed;
+	delete[] picks;
+
+	// sin afinidad, el proceso i de la ronda iria al CPU i
+	for (int cpu = 0; cpu < cpuCount; cpu++) {
+		if (!assigned[cpu]) {
+			continue;
+		}
+		int lastCpu = assigned[cpu]->getTimes().lastCpu;
+		if (lastCpu >= 0 && lastCpu != cpu) {
+			migrations++;
+		}
+		if (lastCpu >= 0 && lastCpu != pickOf[cpu]) {
+			migrationsWithoutAffinity++;
+		}
+		assigned[cpu]->getTimes().lastCpu = cpu;
+	}
+	delete[] pickOf;
+	return pickCount;
+}
+
+void Scheduler::runMultiCore() {
+	Process** assigned = new Process*[cpuCount];
+	while (hasUnfinishedProcesses() || hasPendingSubmissions()) {
+		admitSubmittedProcesses();
+		checkBlockedProcesses();
+		int dispatched;
+		{
+			PROFILE_SCOPE(ProfilePhase::SELECT_NEXT_PROCESS);
+			dispatched = fillRound(assigned);
+		}
+		if (dispatched == 0) {
+			// ningun proceso listo: se salta al final de la siguiente operacion de E/S (la siguiente ronda lo pasa a listos), o se espera a los envios
+			Process* blocked = peekBlockedProcess();
+			if (blocked) {
+				waitUntil(blocked->getTimes().ioDone);
+			} else {
+				waitForSubmissions();
+			}
+			continue;
+		}
+
+		// cada CPU ejecuta su quantum desde el inicio de la ronda; la ronda termina cuando termina el ultimo
+		double roundStart = now();
+		double roundEnd = roundStart;
+		for (int cpu = 0; cpu < cpuCount; cpu++) {
+			if (!assigned[cpu]) {
+				continue;
+			}
+			SimulationClock::setTime(startTime + roundStart);
+			currentProcess = assigned[cpu];
+			currentProcess->setQuantum(getQuantumSlice());
+			chargeContextSwitch(cpu);
+			noteDispatch(*currentProcess, cpu);
+			currentProcess->setState(ProcessState::RUNNING_ACTIVE);
+			executeQuantum();
+			cpuBusy[cpu] += now() - roundStart;
+			if (now() > roundEnd) {
+				roundEnd = now();
+			}
+			delete currentProcess;
+			currentProcess = nullptr;
+		}
+		SimulationClock::setTime(startTime + roundEnd);
+		displayStatus();
+		publishStatus();
+	}
+	delete[] assigned;
+}
+
+void Scheduler::executeQuantum() {
+	executeQuantumWith(*this);
+}
+
+void Scheduler::executeInstructions() {
+	bool batched = SimulationClock::isVirtual() && !instructionTrace;
+	if (batched) {
+		UI::presentState(currentProcess);
+	}
+	while (currentProcess->hasMoreInstrucions()) {
+		// rafaga de instrucciones normales en un solo paso; lo que queda (E/S o una instruccion que no cabe) sigue instruccion por instruccion
+		if (batched && currentProcess->getState() != ProcessState::BLOCKED && currentProcess->executeBurst() > 0
+			&& !currentProcess->hasMoreInstrucions()) {
+			break;
+		}
+		// el costo ya se resolvio al cargar el proceso; aqui solo se consulta su programa
+		double quantumCost = currentProcess->getInstructionCost(currentProcess->getInstructionIndex());
 		if (currentProcess->getState() == ProcessState::BLOCKED) {
 			break;
 		}
-		if (currentProcess->getQuantum() < quantumCost) {
+		if (!currentProcess->fitsInQuantum(quantumCost)) {
 			currentProcess->executeNextInstruction();
 			break;
 		}
-		UI::presentState(currentProcess);
+		if (!batched) {
+			UI::presentState(currentProcess);
+		}
 		currentProcess->executeNextInstruction();
 	}
-	switch(currentProcess->getState()) {
-		case ProcessState::FINISHED:
-			moveToFinished(currentProcess);
-			break;
-		case ProcessState::BLOCKED:
-			moveToBlocked(currentProcess);
-			break;
-		case ProcessState::RUNNING_PREEMPTED:
-			moveToReady(currentProcess);
-			break;
-		default:
-			break;
+}
+
+void Scheduler::executeNativeQuantum() {
+	UI::presentState(currentProcess);
+	if (nativeBackend->runSlice(*currentProcess, currentProcess->getQuantum())) {
+		currentProcess->setState(ProcessState::FINISHED);
+		moveToFinished(currentProcess);
+	} else {
+		currentProcess->setState(ProcessState::RUNNING_PREEMPTED);
+		moveToReady(currentProcess);
 	}
 
 	checkBlockedProcesses();
@@ -102,16 +319,26 @@ void Scheduler::preemptCurrentProcess() {
 }
 
 void Scheduler::checkBlockedProcesses() {
-	if (blockedQueue->getHead()) {
-		if (ioTimer->getStartTime().time_since_epoch() == std::chrono::steady_clock::duration::zero()) {
-			ioTimer->start();
-		}
-		if (ioTimer->checkTime()) {
-			Process process = blockedQueue->getTail()->getData();
-			moveToReady(&process);
-			clearTimer();
+	checkBlockedProcessesWith(*this);
+}
+
+int Scheduler::getBlockedCount() const {
+	int blocked = 0;
+	for (int index = 0; index < deviceCount; index++) {
+		blocked += devices[index]->getSize();
+	}
+	return blocked;
+}
+
+Process* Scheduler::peekBlockedProcess() {
+	Process* first = nullptr;
+	for (int index = 0; index < deviceCount; index++) {
+		Process* candidate = devices[index]->peek();
+		if (candidate && (!first || candidate->getTimes().ioDone < first->getTimes().ioDone)) {
+			first = candidate;
 		}
 	}
+	return first;
 }
 
 void Scheduler::handleProcessStateChange(Process* process, ProcessState newState) {
@@ -136,187 +363,514 @@ void Scheduler::handleProcessStateChange(Process* process, ProcessState newState
 	}
 }
 
-void Scheduler::moveToReady(Process* process) {
-	removeProcess(process);
-	if (process->getState() == ProcessState::BLOCKED) {
-		process->finishIO();
-	}
-	
-	process->setState(ProcessState::READY);
-	readyQueue->insertTail(*process);
-}
-
 void Scheduler::moveToBlocked(Process* process) {
+	PROFILE_SCOPE(ProfilePhase::MOVE_TO_BLOCKED);
 	removeProcess(process);
+	noteBlocked(*process);
 	
 	process->setState(ProcessState::BLOCKED);
-	blockedQueue->insertTail(*process);
+	int device = process->getIODevice();
+	if (device < 0 || device >= deviceCount) {
+		device = CostModel::DEFAULT_DEVICE;
+	}
+	devices[device]->enqueue(*process, now());
 }
 
 void Scheduler::moveToFinished(Process* process) {
+	PROFILE_SCOPE(ProfilePhase::MOVE_TO_FINISHED);
 	removeProcess(process);
+	noteFinished(*process);
 	
 	process->setState(ProcessState::FINISHED);
 	finishedProcesses->insertTail(*process);
 }
 
-void Scheduler::clearTimer() {
-	Timer* old = ioTimer;
-	ioTimer = new Timer(15);
-	delete old;
+double Scheduler::now() const {
+	return SimulationClock::now() - startTime;
 }
 
+void Scheduler::waitUntil(double time) {
+	if (SimulationClock::isVirtual()) {
+		SimulationClock::advance(time - now());
+	}
+}
 
-Process* Scheduler::getCurrent() {
-	return currentProcess;
+// los histogramas guardan microsegundos
+static unsigned long long toMicroseconds(double seconds) {
+	return seconds > 0 ? (unsigned long long) (seconds * 1e6 + 0.5) : 0;
 }
 
-// === ROUND ROBIN ===
+void Scheduler::recordEvent(const char* event, const Process& process, const std::string& detail) {
+	if (!eventTrace) {
+		return;
+	}
+	*eventTrace << toMicroseconds(now()) << " " << event << " " << process.getName();
+	if (!detail.empty()) {
+		*eventTrace << " " << detail;
+	}
+	*eventTrace << "\n";
+}
 
-RoundRobin::RoundRobin() : Scheduler(), quantumSlice(5) {
-	preemptedQueue = new SinglyLinkedList<Process>();
+void Scheduler::recordTransition(const Process& process, TimelineState state, int cpu) {
+	if (timeline) {
+		timeline->transition(process.getTimes().timelineTrack, state, now(), cpu);
+	}
 }
 
-RoundRobin::~RoundRobin() {
-	delete preemptedQueue;
-	preemptedQueue = nullptr;
-	delete readyQueue;
-	readyQueue = nullptr;
-	delete blockedQueue;
-	blockedQueue = nullptr;
-	delete finishedProcesses;
-	finishedProcesses = nullptr;
-	delete currentProcess;
-	currentProcess = nullptr;
-	delete ioTimer;
-	ioTimer = nullptr;
+void Scheduler::chargeContextSwitch(int cpu) {
+	if (currentProcess->getId() == lastDispatched[cpu]) {
+		return;
+	}
+	lastDispatched[cpu] = currentProcess->getId();
+	switchCount++;
+	switchOverhead += switchCost + warmupCost;
+	// el calentamiento lo paga el proceso que entra: sus primeras instrucciones corren con la cache fria
+	currentProcess->setQuantum(currentProcess->getQuantum() - warmupCost);
+	SimulationClock::advance(switchCost + warmupCost);
 }
 
-bool RoundRobin::hasUnfinishedProcesses() {
-	return readyQueue->getSize() > 0 || blockedQueue->getSize() > 0;
+void Scheduler::noteArrival(Process& process) {
+	process.setId(nextProcessId++);
+	recordEvent("llega", process);
+	ProcessTimes& times = process.getTimes();
+	if (timeline) {
+		times.timelineTrack = timeline->addTrack(process.getName());
+	}
+	times.arrival = now();
+	times.readySince = times.arrival;
+	times.waiting = 0;
+	times.dispatched = false;
+	times.absoluteDeadline = process.getDeadline() > 0 ? times.arrival + process.getDeadline() : -1;
+	recordTransition(process, TimelineState::READY);
 }
 
-void RoundRobin::displayStatus() {
-	std::cout << "Procesos listos: " << readyQueue->getSize() << std::endl;
-	std::cout << "Procesos bloqueados: " << blockedQueue->getSize() << std::endl;
-	std::cout << "Procesos terminados: " << finishedProcesses->getSize() << std::endl;
-	std::cout << std::endl;
+void Scheduler::noteReady(Process& process) {
+	ProcessTimes& times = process.getTimes();
+	double current = now();
+	if (process.getState() == ProcessState::BLOCKED) {
+		blockedHistogram->record(toMicroseconds(current - times.blockedSince));
+		recordEvent("desbloquea", process);
+	} else {
+		recordEvent("listo", process);
+	}
+	recordTransition(process, TimelineState::READY);
+	times.readySince = current;
 }
 
-void RoundRobin::selectNextProcess() {
-	if (currentProcess) {
-		readyQueue->deleteByValue(*currentProcess);
-		delete currentProcess;
-		currentProcess = nullptr;
+void Scheduler::noteBlocked(Process& process) {
+	int device = process.getIODevice();
+	if (device < 0 || device >= deviceCount) {
+		device = CostModel::DEFAULT_DEVICE;
+	}
+	recordEvent("bloquea", process, devices[device]->getSpec().name);
+	recordTransition(process, TimelineState::BLOCKED);
+	process.getTimes().blockedSince = now();
+}
+
+void Scheduler::noteDispatch(Process& process, int cpu) {
+	recordEvent("despacha", process, cpuCount > 1 ? "cpu " + std::to_string(cpu) : "");
+	recordTransition(process, TimelineState::RUNNING, cpu);
+	ProcessTimes& times = process.getTimes();
+	double current = now();
+	times.waiting += current - times.readySince;
+	if (!times.dispatched) {
+		times.dispatched = true;
+		responseHistogram->record(toMicroseconds(current - times.arrival));
 	}
-	if (readyQueue->getSize() == 0) {
-		if (blockedQueue->getSize() > 0) {
-			Process blockedTail = blockedQueue->getTail()->getData();
-			currentProcess = new Process(blockedTail);
-			moveToReady(currentProcess);
-			currentProcess->setQuantum(quantumSlice);
+}
+
+void Scheduler::noteFinished(Process& process) {
+	recordEvent("termina", process);
+	recordTransition(process, TimelineState::NONE);
+	const ProcessTimes& times = process.getTimes();
+	waitingHistogram->record(toMicroseconds(times.waiting));
+	if (times.absoluteDeadline >= 0) {
+		deadlineCount++;
+		double lateness = now() - times.absoluteDeadline;
+		if (lateness > 0) {
+			deadlineMisses++;
+			latenessHistogram->record(toMicroseconds(lateness));
+			recordEvent("incumple", process, std::to_string(toMicroseconds(lateness)));
 		}
-		return;
 	}
+}
 
-	Process process = readyQueue->getHead()->getData();
-	currentProcess = new Process(process);
-	currentProcess->setQuantum(quantumSlice);
+const LatencyHistogram& Scheduler::getWaitingHistogram() const {
+	return *waitingHistogram;
 }
 
-// === PLANIFICACION POR PRIORIDAD ===
+const LatencyHistogram& Scheduler::getResponseHistogram() const {
+	return *responseHistogram;
+}
 
-Priority::Priority() : Scheduler() {
-	priorityQueue = new BinarySearchTree<Process>();
+const LatencyHistogram& Scheduler::getBlockedHistogram() const {
+	return *blockedHistogram;
 }
 
-Priority::~Priority() {
-	delete priorityQueue;
-	priorityQueue = nullptr;
-	delete readyQueue;
-	readyQueue = nullptr;
-	delete blockedQueue;
-	blockedQueue = nullptr;
-	delete finishedProcesses;
-	finishedProcesses = nullptr;
-	delete currentProcess;
-	currentProcess = nullptr;
-	delete ioTimer;
-	ioTimer = nullptr;
+const LatencyHistogram& Scheduler::getLatenessHistogram() const {
+	return *latenessHistogram;
 }
 
-void Priority::selectNextProcess() {
-	if (currentProcess) {
-		priorityQueue->remove(*currentProcess);
-		delete currentProcess;
-		currentProcess = nullptr;
+int Scheduler::getDeadlineCount() const {
+	return deadlineCount;
+}
+
+int Scheduler::getDeadlineMisses() const {
+	return deadlineMisses;
+}
+
+void Scheduler::printDeadlineReport(std::ostream& os) const {
+	os << "=== Plazos (" << getPolicyName() << ") ===" << std::endl;
+	os << "Procesos con plazo: " << deadlineCount << ", incumplidos: " << deadlineMisses;
+	if (deadlineCount > 0) {
+		os << " (" << 100.0 * deadlineMisses / deadlineCount << "%)";
+	}
+	os << std::endl;
+	latenessHistogram->print(os, "Retraso", 1e6, "s");
+}
+
+void Scheduler::printLatencyReport(std::ostream& os) const {
+	os << "=== Latencias (" << getPolicyName() << ") ===" << std::endl;
+	waitingHistogram->print(os, "Espera en READY", 1e6, "s");
+	responseHistogram->print(os, "Respuesta", 1e6, "s");
+	blockedHistogram->print(os, "Estadia en BLOCKED", 1e6, "s");
+}
+
+void Scheduler::printDeviceReport(std::ostream& os) const {
+	os << "=== Dispositivos de E/S ===" << std::endl;
+	double elapsed = now();
+	for (int index = 0; index < deviceCount; index++) {
+		devices[index]->printReport(os, elapsed);
+	}
+}
+
+void Scheduler::printSwitchReport(std::ostream& os) const {
+	double elapsed = now();
+	os << "=== Cambios de contexto ===" << std::endl;
+	os << "Cambios: " << switchCount << ", costo total: " << switchOverhead << " s";
+	if (elapsed > 0) {
+		os << " (" << 100 * switchOverhead / elapsed << "% de la corrida)";
 	}
-	if (priorityQueue->getSize() == 0) {
-		if (blockedQueue->getSize() > 0) {
-			Process blockedTail = blockedQueue->getTail()->getData();
-			currentProcess = new Process(blockedTail);
-			moveToReady(currentProcess);
+	os << std::endl;
+	if (elapsed > 0) {
+		// sin cambios de contexto la misma carga habria terminado switchOverhead segundos antes
+		int finished = finishedProcesses->getSize();
+		os << "Rendimiento: " << finished / elapsed << " procesos/s";
+		if (switchOverhead > 0 && elapsed > switchOverhead) {
+			os << " (" << finished / (elapsed - switchOverhead) << " procesos/s sin el costo de los cambios)";
 		}
+		os << std::endl;
+	}
+}
+
+void Scheduler::setDevices(const CostModel& model) {
+	clearDevices();
+	deviceCount = model.getDeviceCount();
+	devices = new IODevice*[deviceCount];
+	for (int index = 0; index < deviceCount; index++) {
+		devices[index] = new IODevice(model.getDevice(index), seed);
+	}
+}
+
+void Scheduler::clearDevices() {
+	for (int index = 0; index < deviceCount; index++) {
+		delete devices[index];
+	}
+	delete[] devices;
+	devices = nullptr;
+	deviceCount = 0;
+}
+
+int Scheduler::getDeviceCount() const {
+	return deviceCount;
+}
+
+const IODevice& Scheduler::getDevice(int index) const {
+	return *devices[index];
+}
+
+
+void Scheduler::setNativeBackend(NativeBackend* newBackend) {
+	if (nativeBackend != newBackend) {
+		delete nativeBackend;
+	}
+	nativeBackend = newBackend;
+}
+
+void Scheduler::setSeed(unsigned int newSeed) {
+	seed = newSeed;
+	for (int index = 0; index < deviceCount; index++) {
+		devices[index]->reseed(seed);
+	}
+}
+
+unsigned int Scheduler::getSeed() const {
+	return seed;
+}
+
+void Scheduler::setEventTrace(std::ostream* stream) {
+	eventTrace = stream;
+}
+
+void Scheduler::setContextSwitchCost(double newSwitchCost, double newWarmupCost) {
+	switchCost = newSwitchCost > 0 ? newSwitchCost : 0;
+	warmupCost = newWarmupCost > 0 ? newWarmupCost : 0;
+}
+
+void Scheduler::setStickyEqualPriority(bool enabled) {
+	stickyEqualPriority = enabled;
+}
+
+int Scheduler::getSwitchCount() const {
+	return switchCount;
+}
+
+double Scheduler::getSwitchOverhead() const {
+	return switchOverhead;
+}
+
+void Scheduler::setCpuCount(int newCpuCount) {
+	cpuCount = newCpuCount > 1 ? newCpuCount : 1;
+	delete[] lastDispatched;
+	lastDispatched = new unsigned long long[cpuCount]{0};
+	delete[] cpuBusy;
+	cpuBusy = new double[cpuCount]{0};
+}
+
+int Scheduler::getCpuCount() const {
+	return cpuCount;
+}
+
+int Scheduler::getMigrations() const {
+	return migrations;
+}
+
+int Scheduler::getMigrationsWithoutAffinity() const {
+	return migrationsWithoutAffinity;
+}
+
+void Scheduler::printCpuReport(std::ostream& os) const {
+	double elapsed = now();
+	os << "=== CPUs ===" << std::endl;
+	for (int cpu = 0; cpu < cpuCount; cpu++) {
+		os << "CPU " << cpu << ": utilizacion " << (elapsed > 0 ? 100 * cpuBusy[cpu] / elapsed : 0) << "%" << std::endl;
+	}
+	os << "Migraciones: " << migrations << " (sin afinidad: " << migrationsWithoutAffinity
+		<< ", evitadas: " << migrationsWithoutAffinity - migrations << ")" << std::endl;
+}
+
+void Scheduler::setTimeline(Timeline* newTimeline) {
+	if (timeline != newTimeline) {
+		delete timeline;
+	}
+	timeline = newTimeline;
+}
+
+const Timeline* Scheduler::getTimeline() const {
+	return timeline;
+}
+
+void Scheduler::setStatusServer(StatusServer* newServer) {
+	if (statusServer != newServer) {
+		delete statusServer;
+	}
+	statusServer = newServer;
+	// los clientes ven el algoritmo y las colas desde antes del primer quantum
+	publishStatus();
+}
+
+StatusServer* Scheduler::getStatusServer() {
+	return statusServer;
+}
+
+static void summarize(const LatencyHistogram& histogram, StatusLatency& latency) {
+	if (histogram.getCount() == latency.count) {
+		return;
+	}
+	latency = StatusLatency{histogram.getCount(), histogram.getMean(), histogram.getPercentile(50), histogram.getPercentile(90),
+		histogram.getPercentile(99), histogram.getMax()};
+}
+
+void Scheduler::publishStatus(bool finished) {
+	if (!statusServer) {
 		return;
 	}
+	StatusSnapshot snapshot = {};
+	snapshot.quantums = ++statusCount;
+	snapshot.time = now();
+	snapshot.finished = finished;
+	std::strncpy(snapshot.policy, getPolicyName(), sizeof(snapshot.policy) - 1);
+	if (currentProcess && !finished) {
+		std::strncpy(snapshot.current, currentProcess->getName().c_str(), sizeof(snapshot.current) - 1);
+	}
+	snapshot.ready = getReadyCount();
+	snapshot.blocked = getBlockedCount();
+	snapshot.finishedProcesses = finishedProcesses->getSize();
+	snapshot.cpuCount = cpuCount;
+	snapshot.switchCount = switchCount;
+	snapshot.switchOverhead = switchOverhead;
+	snapshot.migrations = migrations;
+	snapshot.deadlineCount = deadlineCount;
+	snapshot.deadlineMisses = deadlineMisses;
+	// publicar cada quantum es O(1): los resumenes se reusan hasta que pasa STATUS_REFRESH_MS, salvo en la ultima foto
+	std::chrono::steady_clock::time_point wallNow = std::chrono::steady_clock::now();
+	if (finished || wallNow - statusRefreshedAt >= std::chrono::milliseconds(STATUS_REFRESH_MS)) {
+		statusRefreshedAt = wallNow;
+		summarize(*waitingHistogram, statusLatencies[0]);
+		summarize(*responseHistogram, statusLatencies[1]);
+		summarize(*blockedHistogram, statusLatencies[2]);
+		summarize(*latenessHistogram, statusLatencies[3]);
+	}
+	snapshot.waiting = statusLatencies[0];
+	snapshot.response = statusLatencies[1];
+	snapshot.blockedTime = statusLatencies[2];
+	snapshot.lateness = statusLatencies[3];
+	statusServer->publish(snapshot);
+}
+
+void Scheduler::setDynamicDispatch(bool enabled) {
+	dynamicDispatch = enabled;
+}
+
+bool Scheduler::hasDynamicDispatch() const {
+	return dynamicDispatch;
+}
+
+void Scheduler::setInstructionTrace(bool enabled) {
+	instructionTrace = enabled;
+}
+
+bool Scheduler::hasInstructionTrace() const {
+	return instructionTrace;
+}
+
+NativeBackend* Scheduler::getNativeBackend() {
+	return nativeBackend;
+}
+
+Process* Scheduler::getCurrent() {
+	return currentProcess;
+}
+
+// === ROUND ROBIN ===
+
+RoundRobinPolicy::RoundRobinPolicy() : quantumSlice(5) {}
+
+float RoundRobinPolicy::getQuantumSlice() const {
+	return quantumSlice;
+}
+
+RoundRobin::RoundRobin() : SchedulerCore() {}
+
+const char* RoundRobin::getPolicyName() const {
+	return "Round Robin";
+}
+
+// === PLANIFICACION POR PRIORIDAD ===
 
-	Process process = priorityQueue->getMax()->getData();
-	currentProcess = new Process(process);
-	currentProcess->setQuantum(1024);
+float PriorityPolicy::getQuantumSlice() const {
+	return 1024;
 }
 
-bool Priority::hasUnfinishedProcesses() {
-	return priorityQueue->getRoot() != nullptr || blockedQueue->getSize() > 0;
+void PriorityPolicy::calculateInitialPriority(Process& process) {
+	process.setPriority(process.projectPriority(process.getPriority(), 1));
 }
 
-void Priority::displayStatus() {
-	std::cout << "Procesos listos: " << priorityQueue->getSize() << std::endl;
-	std::cout << "Procesos bloqueados: " << blockedQueue->getSize() << std::endl;
-	std::cout << "Procesos terminados: " << finishedProcesses->getSize() << std::endl;
-	std::cout << std::endl;
+Priority::Priority() : SchedulerCore() {}
+
+const char* Priority::getPolicyName() const {
+	return "Prioridad";
 }
 
 void Priority::calculateInitialPriority(Process& process) {
-	int priority = process.getPriority();
-	SinglyLinkedListNode<std::string>* current = process.getInstructions()->getHead();
-	while (current) {
-		if (current->getData() == "e/s") {
-			priority = std::max(0, priority - 1);
+	policy.calculateInitialPriority(process);
+}
+
+void Priority::addProcesses(const SinglyLinkedList<Process>& processes) {
+	// el lote se arma al reves y se ordena de forma estable: entre prioridades iguales el ultimo admitido queda primero,
+	// igual que si se hubieran insertado uno por uno (los iguales van a la izquierda)
+	SinglyLinkedList<Process> batch;
+	for (const Process& process : processes) {
+		Process& admitted = batch.emplaceHead(process);
+		noteArrival(admitted);
+		calculateInitialPriority(admitted);
+	}
+	batch.sortBy([](const Process& a, const Process& b) { return a.getPriority() < b.getPriority(); });
+
+	// mezcla con los procesos que ya estaban en el arbol; los nuevos van antes que los viejos de igual prioridad
+	SinglyLinkedList<Process> merged;
+	BinarySearchTree<Process>::iterator old = ready.begin();
+	BinarySearchTree<Process>::iterator oldEnd = ready.end();
+	SinglyLinkedList<Process>::iterator added = batch.begin();
+	while (old != oldEnd || added != batch.end()) {
+		if (old == oldEnd || (added != batch.end() && added->getPriority() <= old->getPriority())) {
+			merged.insertTail(std::move(*added));
+			++added;
 		} else {
-			priority = std::min(10, priority + 1);
+			merged.insertTail(std::move(*old));
+			++old;
 		}
-		current = current->getNext();
 	}
-	process.setPriority(priority);
+	ready.buildFromSorted(std::make_move_iterator(merged.begin()), std::make_move_iterator(merged.end()));
 }
 
-void Priority::addProcess(Process* newProcess) {
-	calculateInitialPriority(*newProcess);
-	priorityQueue->insert(*newProcess);
+void Priority::adjustProcessPriority(Process& process) {
+	policy.adjustPriority(*this, process);
 }
 
-void Priority::adjustProcessPriority(Process& process) {
-	int temp = process.getPriority();
-	SinglyLinkedListNode<std::string>* current = process.getInstructions()->getAt(process.getInstructionIndex());
-	while (current) {
-		if (current->getData() == "e/s") {
-			temp = std::max(0, temp -1);
-		} else {
-			temp = std::min(10, temp +1);
-		} 
-		current = current->getNext();
+// === TIEMPO REAL ===
+
+DeadlinePolicy::DeadlinePolicy(BinaryHeap<Process>::Comparison newBefore) : before(newBefore), quantumSlice(5) {}
+
+float DeadlinePolicy::getQuantumSlice() const {
+	return quantumSlice;
+}
+
+RealTimeScheduler::RealTimeScheduler(BinaryHeap<Process>::Comparison newBefore)
+	: SchedulerCore(DeadlinePolicy(newBefore), BinaryHeap<Process>(newBefore)) {}
+
+/// @brief Desempate comun de los algoritmos de tiempo real: primero el que llego antes, luego por nombre
+static bool arrivedFirst(const Process& a, const Process& b) {
+	if (a.getTimes().arrival != b.getTimes().arrival) {
+		return a.getTimes().arrival < b.getTimes().arrival;
 	}
-	process.setPriority(temp);
-	
-	priorityQueue->insert(process);
+	return a.getName() < b.getName();
 }
 
-void Priority::moveToReady(Process* process) {
-	removeProcess(process);
-	if (process->getState() == ProcessState::BLOCKED) {
-		process->finishIO();
+/// @brief Orden de EDF: el plazo absoluto mas cercano primero; sin plazo al final
+static bool earlierDeadline(const Process& a, const Process& b) {
+	double first = a.getTimes().absoluteDeadline;
+	double second = b.getTimes().absoluteDeadline;
+	if ((first < 0) != (second < 0)) {
+		return second < 0;
 	}
-	
-	process->setState(ProcessState::READY);
-	adjustProcessPriority(*process);
-}
\ No newline at end of file
+	if (first != second) {
+		return first < second;
+	}
+	return arrivedFirst(a, b);
+}
+
+/// @brief Orden de RM: el periodo mas corto primero (o el plazo si no tiene periodo); sin ninguno al final
+static bool shorterPeriod(const Process& a, const Process& b) {
+	double first = a.getPeriod() > 0 ? a.getPeriod() : a.getDeadline();
+	double second = b.getPeriod() > 0 ? b.getPeriod() : b.getDeadline();
+	if ((first <= 0) != (second <= 0)) {
+		return second <= 0;
+	}
+	if (first != second) {
+		return first < second;
+	}
+	return arrivedFirst(a, b);
+}
+
+EarliestDeadlineFirst::EarliestDeadlineFirst() : RealTimeScheduler(earlierDeadline) {}
+
+const char* EarliestDeadlineFirst::getPolicyName() const {
+	return "Plazo mas cercano (EDF)";
+}
+
+RateMonotonic::RateMonotonic() : RealTimeScheduler(shorterPeriod) {}
+
+const char* RateMonotonic::getPolicyName() const {
+	return "Tasa monotona (RM)";
+}
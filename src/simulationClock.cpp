@@ -0,0 +1,53 @@
+#include <simulationClock.h>
+#include <chrono>
+#ifdef _WINDOWS32
+  #include <windows.h>
+#else
+  #include <unistd.h>
+#endif
+
+std::atomic<long long> SimulationClock::virtualMicroseconds(0);
+std::atomic<bool> SimulationClock::virtualMode(false);
+
+// origen del tiempo real: se toma al cargar el programa
+static const std::chrono::steady_clock::time_point realEpoch = std::chrono::steady_clock::now();
+
+void SimulationClock::setVirtual(bool enabled) {
+  virtualMode.store(enabled, std::memory_order_relaxed);
+}
+
+bool SimulationClock::isVirtual() {
+  return virtualMode.load(std::memory_order_relaxed);
+}
+
+void SimulationClock::reset() {
+  virtualMicroseconds.store(0, std::memory_order_relaxed);
+}
+
+double SimulationClock::now() {
+  if (isVirtual()) {
+    return virtualMicroseconds.load(std::memory_order_relaxed) / 1e6;
+  }
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - realEpoch).count();
+}
+
+void SimulationClock::setTime(double seconds) {
+  if (isVirtual()) {
+    virtualMicroseconds.store(seconds > 0 ? (long long) (seconds * 1e6 + 0.5) : 0, std::memory_order_relaxed);
+  }
+}
+
+void SimulationClock::advance(double seconds) {
+  if (seconds <= 0) {
+    return;
+  }
+  if (isVirtual()) {
+    virtualMicroseconds.fetch_add((long long) (seconds * 1e6 + 0.5), std::memory_order_relaxed);
+    return;
+  }
+#ifdef _WINDOWS32
+  Sleep(seconds * 1000);
+#else
+  sleep(seconds);
+#endif
+}
@@ -0,0 +1,224 @@
+#include <statusServer.h>
+#include <cerrno>
+#include <cstring>
+#include <sstream>
+#ifndef _WINDOWS32
+  #include <poll.h>
+  #include <sys/socket.h>
+  #include <sys/stat.h>
+  #include <sys/un.h>
+  #include <unistd.h>
+#endif
+
+// cada cuanto el hilo revisa si debe detenerse, en milisegundos
+static const int POLL_INTERVAL = 100;
+
+/// @brief Escapa un nombre para ponerlo en un string de JSON
+static std::string escape(const char* text) {
+  std::string escaped;
+  for (const char* character = text; *character; character++) {
+    if (*character == '"' || *character == '\\') {
+      escaped += '\\';
+    }
+    if ((unsigned char) *character >= 0x20) {
+      escaped += *character;
+    }
+  }
+  return escaped;
+}
+
+static void writeLatency(std::ostream& os, const char* name, const StatusLatency& latency) {
+  os << "\"" << name << "\":{\"count\":" << latency.count << ",\"mean\":" << latency.mean << ",\"p50\":" << latency.p50
+    << ",\"p90\":" << latency.p90 << ",\"p99\":" << latency.p99 << ",\"max\":" << latency.max << "}";
+}
+
+StatusServer::StatusServer(const std::string& newPath) : path(newPath), board(new Seqlock<StatusSnapshot>()), listenFd(-1),
+  thread(nullptr), running(false), served(0), socketDevice(0),
+  socketInode(0) {}
+
+StatusServer::~StatusServer() {
+  stop();
+  delete board;
+  board = nullptr;
+}
+
+bool StatusServer::isSupported() {
+#ifdef _WINDOWS32
+  return false;
+#else
+  return true;
+#endif
+}
+
+bool StatusServer::start() {
+#ifndef _WINDOWS32
+  if (running.load()) {
+    return true;
+  }
+  sockaddr_un address;
+  std::memset(&address, 0, sizeof(address));
+  address.sun_family = AF_UNIX;
+  if (path.empty() || path.size() >= sizeof(address.sun_path)) {
+    std::cerr << "Ruta invalida para el socket de estado: " << path << std::endl;
+    return false;
+  }
+  std::strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+  // solo se borra un socket que haya quedado en la ruta; cualquier otro archivo se respeta
+  struct stat existing;
+  if (lstat(path.c_str(), &existing) == 0) {
+    if (!S_ISSOCK(existing.st_mode)) {
+      std::cerr << "La ruta del socket de estado ya existe y no es un socket: " << path << std::endl;
+      return false;
+    }
+    unlink(path.c_str());
+  }
+  listenFd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (listenFd < 0) {
+    std::cerr << "Error al crear el socket de estado: " << std::strerror(errno) << std::endl;
+    return false;
+  }
+  struct stat created;
+  if (bind(listenFd, (sockaddr*) &address, sizeof(address)) < 0 || listen(listenFd, 8) < 0 || lstat(path.c_str(), &created) < 0) {
+    std::cerr << "Error al abrir el socket de estado " << path << ": " << std::strerror(errno) << std::endl;
+    close(listenFd);
+    listenFd = -1;
+    return false;
+  }
+  socketDevice = created.st_dev;
+  socketInode = created.st_ino;
+  running.store(true);
+  thread = new std::thread(&StatusServer::serve, this);
+  return true;
+#else
+  std::cerr << "El servidor de estado no está disponible en esta plataforma." << std::endl;
+  return false;
+#endif
+}
+
+void StatusServer::stop() {
+#ifndef _WINDOWS32
+  if (!thread) {
+    return;
+  }
+  running.store(false);
+  thread->join();
+  delete thread;
+  thread = nullptr;
+  close(listenFd);
+  listenFd = -1;
+  struct stat current;
+  if (lstat(path.c_str(), &current) == 0 && S_ISSOCK(current.st_mode) && (unsigned long long) current.st_dev == socketDevice
+    && (unsigned long long) current.st_ino == socketInode) {
+    unlink(path.c_str());
+  }
+#endif
+}
+
+void StatusServer::serve() {
+#ifndef _WINDOWS32
+  while (running.load()) {
+    pollfd listener = {listenFd, POLLIN, 0};
+    if (poll(&listener, 1, POLL_INTERVAL) <= 0) {
+      continue;
+    }
+    int clientFd = accept(listenFd, nullptr, nullptr);
+    if (clientFd >= 0) {
+      answer(clientFd);
+    }
+  }
+#endif
+}
+
+void StatusServer::answer(int clientFd) {
+#ifndef _WINDOWS32
+  // la peticion no importa: se lee lo que haya llegado (sin esperar mas de un intervalo) para no cerrar con datos sin leer
+  pollfd client = {clientFd, POLLIN, 0};
+  char request[1024];
+  if (poll(&client, 1, POLL_INTERVAL) > 0) {
+    ssize_t ignored = read(clientFd, request, sizeof(request));
+    (void) ignored;
+  }
+  std::stringstream body;
+  writeJson(body, getSnapshot());
+  std::string response = "HTTP/1.0 200 OK\r\nContent-Type: application/json\r\nContent-Length: " + std::to_string(body.str().size())
+    + "\r\nConnection: close\r\n\r\n" + body.str();
+  size_t sent = 0;
+  while (sent < response.size()) {
+    ssize_t written = send(clientFd, response.data() + sent, response.size() - sent, MSG_NOSIGNAL);
+    if (written <= 0) {
+      break;
+    }
+    sent += written;
+  }
+  // se cuenta antes de cerrar: al ver el fin de la respuesta el cliente ya puede consultar la cuenta
+  served.fetch_add(1);
+  close(clientFd);
+#endif
+}
+
+void StatusServer::publish(const StatusSnapshot& snapshot) {
+  board->write(snapshot);
+}
+
+StatusSnapshot StatusServer::getSnapshot() const {
+  return board->read();
+}
+
+unsigned long long StatusServer::getServedCount() const {
+  return served.load();
+}
+
+const std::string& StatusServer::getPath() const {
+  return path;
+}
+
+void StatusServer::writeJson(std::ostream& os, const StatusSnapshot& snapshot) {
+  os << "{\"quantums\":" << snapshot.quantums << ",\"time\":" << snapshot.time << ",\"finished\":" << (snapshot.finished ? "true" : "false")
+    << ",\"policy\":\"" << escape(snapshot.policy) << "\",\"current\":"
+    << (snapshot.current[0] ? "\"" + escape(snapshot.current) + "\"" : std::string("null"))
+    << ",\"queues\":{\"ready\":" << snapshot.ready << ",\"blocked\":" << snapshot.blocked << ",\"finished\":" << snapshot.finishedProcesses << "}"
+    << ",\"cpus\":" << snapshot.cpuCount << ",\"switches\":" << snapshot.switchCount << ",\"switchOverhead\":" << snapshot.switchOverhead
+    << ",\"migrations\":" << snapshot.migrations
+    << ",\"deadlines\":{\"count\":" << snapshot.deadlineCount << ",\"misses\":" << snapshot.deadlineMisses << "}"
+    << ",\"latencies\":{";
+  writeLatency(os, "waiting", snapshot.waiting);
+  os << ",";
+  writeLatency(os, "response", snapshot.response);
+  os << ",";
+  writeLatency(os, "blocked", snapshot.blockedTime);
+  os << ",";
+  writeLatency(os, "lateness", snapshot.lateness);
+  os << "}}";
+}
+
+bool StatusServer::query(const std::string& socketPath, std::string& response) {
+#ifndef _WINDOWS32
+  sockaddr_un address;
+  std::memset(&address, 0, sizeof(address));
+  address.sun_family = AF_UNIX;
+  if (socketPath.size() >= sizeof(address.sun_path)) {
+    return false;
+  }
+  std::strncpy(address.sun_path, socketPath.c_str(), sizeof(address.sun_path) - 1);
+  int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (fd < 0) {
+    return false;
+  }
+  if (connect(fd, (sockaddr*) &address, sizeof(address)) < 0) {
+    close(fd);
+    return false;
+  }
+  const char request[] = "GET / HTTP/1.0\r\n\r\n";
+  send(fd, request, sizeof(request) - 1, MSG_NOSIGNAL);
+  response.clear();
+  char buffer[4096];
+  ssize_t received;
+  while ((received = read(fd, buffer, sizeof(buffer))) > 0) {
+    response.append(buffer, received);
+  }
+  close(fd);
+  return !response.empty();
+#else
+  return false;
+#endif
+}
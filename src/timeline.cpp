@@ -0,0 +1,253 @@
+#include <timeline.h>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <utility>
+
+/// @brief Agranda un arreglo al doble de su capacidad, moviendo los elementos que tiene.
+template <typename T>
+static void grow(T*& array, int size, int newCapacity) {
+  T* newArray = new T[newCapacity];
+  for (int index = 0; index < size; index++) {
+    newArray[index] = std::move(array[index]);
+  }
+  delete[] array;
+  array = newArray;
+}
+
+// la traza de Chrome usa microsegundos enteros: redondear cada extremo hace que los intervalos contiguos sigan pegados
+static long long toMicroseconds(double seconds) {
+  return seconds > 0 ? (long long) (seconds * 1e6 + 0.5) : 0;
+}
+
+/// @brief Escribe segundos con precision de microsegundos y sin notacion cientifica, para los titulos del diagrama de Gantt.
+static std::string formatSeconds(double seconds) {
+  std::ostringstream text;
+  text << std::fixed << std::setprecision(6) << seconds;
+  return text.str();
+}
+
+static const char* stateName(TimelineState state) {
+  switch (state) {
+    case TimelineState::READY:
+      return "READY";
+    case TimelineState::RUNNING:
+      return "RUNNING";
+    case TimelineState::BLOCKED:
+      return "BLOCKED";
+    default:
+      return "NONE";
+  }
+}
+
+static const char* stateColor(TimelineState state) {
+  switch (state) {
+    case TimelineState::READY:
+      return "#e8c547";
+    case TimelineState::RUNNING:
+      return "#4caf50";
+    default:
+      return "#e57373";
+  }
+}
+
+/// @brief Escapa un nombre para ponerlo en HTML o en un string de JSON
+static std::string escape(const std::string& text, bool json) {
+  std::string escaped;
+  for (char character : text) {
+    if (json && (character == '"' || character == '\\')) {
+      escaped += '\\';
+      escaped += character;
+    } else if (!json && character == '<') {
+      escaped += "&lt;";
+    } else if (!json && character == '&') {
+      escaped += "&amp;";
+    } else if (!json && character == '"') {
+      escaped += "&quot;";
+    } else {
+      escaped += character;
+    }
+  }
+  return escaped;
+}
+
+Timeline::Timeline() : intervals(nullptr), intervalCount(0), intervalCapacity(0), names(nullptr), openStates(nullptr),
+  openStarts(nullptr), openCpus(nullptr), lastIntervals(nullptr), trackCount(0), trackCapacity(0), cpuCount(1) {}
+
+Timeline::~Timeline() {
+  delete[] intervals;
+  delete[] names;
+  delete[] openStates;
+  delete[] openStarts;
+  delete[] openCpus;
+  delete[] lastIntervals;
+}
+
+int Timeline::addTrack(const std::string& name) {
+  if (trackCount == trackCapacity) {
+    int newCapacity = trackCapacity == 0 ? 16 : trackCapacity * 2;
+    grow(names, trackCount, newCapacity);
+    grow(openStates, trackCount, newCapacity);
+    grow(openStarts, trackCount, newCapacity);
+    grow(openCpus, trackCount, newCapacity);
+    grow(lastIntervals, trackCount, newCapacity);
+    trackCapacity = newCapacity;
+  }
+  names[trackCount] = name;
+  openStates[trackCount] = TimelineState::NONE;
+  openStarts[trackCount] = 0;
+  openCpus[trackCount] = 0;
+  lastIntervals[trackCount] = -1;
+  return trackCount++;
+}
+
+void Timeline::closeTrack(int track, double time) {
+  TimelineState state = openStates[track];
+  double start = openStarts[track];
+  int cpu = openCpus[track];
+  openStates[track] = TimelineState::NONE;
+  if (state == TimelineState::NONE || time <= start) {
+    return;
+  }
+  // se une con el intervalo anterior si es del mismo estado y no hay hueco entre ellos
+  int last = lastIntervals[track];
+  if (last >= 0 && intervals[last].state == state && intervals[last].cpu == cpu && intervals[last].end >= start) {
+    intervals[last].end = time;
+    return;
+  }
+  if (intervalCount == intervalCapacity) {
+    intervalCapacity = intervalCapacity == 0 ? 64 : intervalCapacity * 2;
+    grow(intervals, intervalCount, intervalCapacity);
+  }
+  intervals[intervalCount] = TimelineInterval{track, cpu, state, start, time};
+  lastIntervals[track] = intervalCount++;
+}
+
+void Timeline::transition(int track, TimelineState state, double time, int cpu) {
+  if (track < 0 || track >= trackCount) {
+    return;
+  }
+  if (state == openStates[track] && (state != TimelineState::RUNNING || cpu == openCpus[track])) {
+    return;
+  }
+  closeTrack(track, time);
+  openStates[track] = state;
+  openStarts[track] = time;
+  openCpus[track] = cpu;
+  if (cpu >= cpuCount) {
+    cpuCount = cpu + 1;
+  }
+}
+
+void Timeline::close(double time) {
+  for (int track = 0; track < trackCount; track++) {
+    closeTrack(track, time);
+  }
+}
+
+int Timeline::getTrackCount() const {
+  return trackCount;
+}
+
+const std::string& Timeline::getTrackName(int track) const {
+  return names[track];
+}
+
+int Timeline::getIntervalCount() const {
+  return intervalCount;
+}
+
+const TimelineInterval& Timeline::getInterval(int index) const {
+  return intervals[index];
+}
+
+double Timeline::getEnd() const {
+  double end = 0;
+  for (int index = 0; index < intervalCount; index++) {
+    if (intervals[index].end > end) {
+      end = intervals[index].end;
+    }
+  }
+  return end;
+}
+
+void Timeline::writeGantt(std::ostream& os) const {
+  const int labelWidth = 160;
+  const int chartWidth = 1200;
+  const int rowHeight = 16;
+  double end = getEnd();
+  double scale = end > 0 ? chartWidth / end : 0;
+  int rows = cpuCount + trackCount;
+  os << "<!DOCTYPE html>\n<html><head><meta charset=\"utf-8\"><title>Planificador</title></head><body>\n"
+    << "<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"" << labelWidth + chartWidth << "\" height=\"" << (rows + 1) * rowHeight
+    << "\" font-family=\"monospace\" font-size=\"11\">\n";
+  for (int cpu = 0; cpu < cpuCount; cpu++) {
+    os << "<text x=\"2\" y=\"" << (cpu + 1) * rowHeight - 4 << "\">CPU " << cpu << "</text>\n";
+  }
+  for (int track = 0; track < trackCount; track++) {
+    os << "<text x=\"2\" y=\"" << (cpuCount + track + 1) * rowHeight - 4 << "\">" << escape(names[track], false) << "</text>\n";
+  }
+  for (int index = 0; index < intervalCount; index++) {
+    const TimelineInterval& interval = intervals[index];
+    double x = labelWidth + interval.start * scale;
+    double width = (interval.end - interval.start) * scale;
+    std::string title = escape(names[interval.track], false) + " " + stateName(interval.state)
+      + " [" + formatSeconds(interval.start) + ", " + formatSeconds(interval.end) + ")";
+    os << "<rect x=\"" << x << "\" y=\"" << (cpuCount + interval.track) * rowHeight + 1 << "\" width=\"" << width
+      << "\" height=\"" << rowHeight - 2 << "\" fill=\"" << stateColor(interval.state) << "\"><title>" << title << "</title></rect>\n";
+    if (interval.state == TimelineState::RUNNING) {
+      // en la fila del CPU, cada proceso tiene su propio color
+      os << "<rect x=\"" << x << "\" y=\"" << interval.cpu * rowHeight + 1 << "\" width=\"" << width << "\" height=\"" << rowHeight - 2
+        << "\" fill=\"hsl(" << (interval.track * 137) % 360 << ",60%,55%)\"><title>" << title << "</title></rect>\n";
+    }
+  }
+  os << "<text x=\"" << labelWidth << "\" y=\"" << (rows + 1) * rowHeight - 4 << "\">0 s</text>\n"
+    << "<text x=\"" << labelWidth + chartWidth << "\" y=\"" << (rows + 1) * rowHeight - 4 << "\" text-anchor=\"end\">" << formatSeconds(end) << " s</text>\n"
+    << "</svg>\n</body></html>" << std::endl;
+}
+
+void Timeline::writeChromeTrace(std::ostream& os) const {
+  // pid 1: una fila por CPU con lo que corrio en ella; pid 2: una fila por proceso con sus estados
+  os << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n"
+    << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"CPUs\"}},\n"
+    << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":2,\"args\":{\"name\":\"Procesos\"}}";
+  for (int cpu = 0; cpu < cpuCount; cpu++) {
+    os << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << cpu << ",\"args\":{\"name\":\"CPU " << cpu << "\"}}";
+  }
+  for (int track = 0; track < trackCount; track++) {
+    os << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":2,\"tid\":" << track
+      << ",\"args\":{\"name\":\"" << escape(names[track], true) << "\"}}";
+  }
+  for (int index = 0; index < intervalCount; index++) {
+    const TimelineInterval& interval = intervals[index];
+    long long start = toMicroseconds(interval.start);
+    long long duration = toMicroseconds(interval.end) - start;
+    os << ",\n{\"name\":\"" << stateName(interval.state) << "\",\"cat\":\"proceso\",\"ph\":\"X\",\"pid\":2,\"tid\":" << interval.track
+      << ",\"ts\":" << start << ",\"dur\":" << duration << "}";
+    if (interval.state == TimelineState::RUNNING) {
+      os << ",\n{\"name\":\"" << escape(names[interval.track], true) << "\",\"cat\":\"cpu\",\"ph\":\"X\",\"pid\":1,\"tid\":" << interval.cpu
+        << ",\"ts\":" << start << ",\"dur\":" << duration << "}";
+    }
+  }
+  os << "\n]}" << std::endl;
+}
+
+bool Timeline::writeGantt(const std::string& filename) const {
+  std::ofstream file(filename);
+  if (!file.is_open()) {
+    std::cerr << "Error al abrir el archivo del diagrama de Gantt " << filename << std::endl;
+    return false;
+  }
+  writeGantt(file);
+  return true;
+}
+
+bool Timeline::writeChromeTrace(const std::string& filename) const {
+  std::ofstream file(filename);
+  if (!file.is_open()) {
+    std::cerr << "Error al abrir el archivo de trace " << filename << std::endl;
+    return false;
+  }
+  writeChromeTrace(file);
+  return true;
+}
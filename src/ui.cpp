@@ -1,11 +1,17 @@
 #include <iostream>
+#include <cstdlib>
+#include <profiler.h>
 #include <scheduler.h>
 #include <ui.h>
 
-UI::UI() : filename(""), scheduler(nullptr) {}
+UI::UI() : filename(""), scheduler(nullptr), useNativeBackend(false), pinnedCpu(-1),
+	printProfile(false), usePerfCounters(false), profileTraceFile(""), virtualTime(false), instructionTrace(false),
+	deterministic(false), seed(0), eventTraceFile(""), eventTraceStream(nullptr), ganttFile(""), timelineTraceFile(""),
+	switchCost(0), warmupCost(0), stickyEqualPriority(false), cpuCount(1), statusSocket(""), policyName("") {}
 
 UI::~UI() {
 	delete scheduler;
+	delete eventTraceStream;
 }
 
 void UI::setFilename(const std::string& newFilename) {
@@ -52,12 +58,18 @@ void UI::askForFileName() {
 void UI::askForScheduler() {
 	int option;
 	while (true) {
-		std::cout << "Elija el algoritmo de planificación a utilizar: [1: Round Robin], [2: Planificación por prioridad]" << std::endl; std::cin >> option;
+		std::cout << "Elija el algoritmo de planificación a utilizar: [1: Round Robin], [2: Planificación por prioridad], [3: Plazo más cercano (EDF)], [4: Tasa monótona (RM)]" << std::endl; std::cin >> option;
 		if (option==1) {
-			scheduler = new RoundRobin();
+			scheduler = createScheduler("rr");
 			break;
 		} else if (option == 2){
-			scheduler = new Priority();
+			scheduler = createScheduler("prioridad");
+			break;
+		} else if (option == 3) {
+			scheduler = createScheduler("edf");
+			break;
+		} else if (option == 4) {
+			scheduler = createScheduler("rm");
 			break;
 		} else {
 			std::cout << "Opción inválida, inténtelo de nuevo." << std::endl;
@@ -65,6 +77,26 @@ void UI::askForScheduler() {
 	}
 }
 
+bool UI::isPolicyName(const std::string& name) {
+	return name == "rr" || name == "prioridad" || name == "edf" || name == "rm";
+}
+
+Scheduler* UI::createScheduler(const std::string& name) {
+	if (name == "rr") {
+		return new RoundRobin();
+	}
+	if (name == "prioridad") {
+		return new Priority();
+	}
+	if (name == "edf") {
+		return new EarliestDeadlineFirst();
+	}
+	if (name == "rm") {
+		return new RateMonotonic();
+	}
+	return nullptr;
+}
+
 //esto va antes de "schedule();" (line81 scheduler.cpp)
 void UI::presentState(Process* currentProcess) {
 	//clearCLI();
@@ -76,8 +108,14 @@ void UI::presentState(Process* currentProcess) {
 	}
 	std::cout << "." << std::endl;
 	if (currentProcess->getState() != ProcessState::BLOCKED || currentProcess->getState() != ProcessState::RUNNING_PREEMPTED) {
-		std::cout << "Instrucción actual: " << currentProcess->getInstructions()->getAt(currentProcess->getInstructionIndex())->getData() << std::endl;
-		std::cout << "Índice de la instrucción: " << currentProcess->getInstructionIndex() << std::endl;
+		const std::string* instruction = currentProcess->getInstruction(currentProcess->getInstructionIndex());
+		if (instruction) {
+			std::cout << "Instrucción actual: " << *instruction << std::endl;
+			std::cout << "Índice de la instrucción: " << currentProcess->getInstructionIndex() << std::endl;
+		}
+		if (currentProcess->hasCommand()) {
+			std::cout << "Comando: " << currentProcess->getCommand() << std::endl;
+		}
 	}
 }
 
@@ -89,7 +127,154 @@ void UI::clearCLI() {
 #endif
 }
 
+bool UI::parseArguments(int argc, char* argv[]) {
+	for (int i = 1; i < argc; i++) {
+		std::string argument = argv[i];
+		if (argument == "--native") {
+			useNativeBackend = true;
+		} else if (argument == "--pin-cpu" && i + 1 < argc) {
+			pinnedCpu = std::atoi(argv[++i]);
+		} else if (argument == "--profile") {
+			printProfile = true;
+		} else if (argument == "--perf-counters") {
+			printProfile = true;
+			usePerfCounters = true;
+		} else if (argument == "--profile-trace" && i + 1 < argc) {
+			printProfile = true;
+			profileTraceFile = argv[++i];
+		} else if (argument == "--virtual-time") {
+			virtualTime = true;
+		} else if (argument == "--trace") {
+			instructionTrace = true;
+		} else if (argument == "--deterministic") {
+			deterministic = true;
+		} else if (argument == "--seed" && i + 1 < argc) {
+			deterministic = true;
+			seed = (unsigned int) std::strtoul(argv[++i], nullptr, 10);
+		} else if (argument == "--event-trace" && i + 1 < argc) {
+			eventTraceFile = argv[++i];
+		} else if (argument == "--gantt" && i + 1 < argc) {
+			ganttFile = argv[++i];
+		} else if (argument == "--timeline-trace" && i + 1 < argc) {
+			timelineTraceFile = argv[++i];
+		} else if (argument == "--switch-cost" && i + 1 < argc) {
+			switchCost = std::atof(argv[++i]);
+		} else if (argument == "--warmup-cost" && i + 1 < argc) {
+			warmupCost = std::atof(argv[++i]);
+		} else if (argument == "--sticky") {
+			stickyEqualPriority = true;
+		} else if (argument == "--cpus" && i + 1 < argc && std::atoi(argv[i + 1]) > 0) {
+			virtualTime = true;
+			cpuCount = std::atoi(argv[++i]);
+		} else if (argument == "--status-socket" && i + 1 < argc) {
+			statusSocket = argv[++i];
+		} else if (argument == "--file" && i + 1 < argc) {
+			filename = argv[++i];
+		} else if (argument == "--policy" && i + 1 < argc && isPolicyName(argv[i + 1])) {
+			policyName = argv[++i];
+		} else {
+			printUsage();
+			return false;
+		}
+	}
+	return true;
+}
+
+void UI::printUsage() {
+	std::cout << "Uso: executable [opciones]" << std::endl;
+	std::cout << "  --native       Ejecuta el 'comando' de cada proceso como un proceso real (fork/exec) en lugar de simularlo" << std::endl;
+	std::cout << "  --pin-cpu N    Con --native, fija todos los procesos reales al CPU N (sched_setaffinity)" << std::endl;
+	std::cout << "  --profile      Al terminar, muestra el tiempo de cada fase del planificador (requiere make PROFILE=1)" << std::endl;
+	std::cout << "  --perf-counters  Como --profile, y ademas lee ciclos, instrucciones y fallos de cache con perf_event_open" << std::endl;
+	std::cout << "  --profile-trace ARCHIVO  Como --profile, y ademas escribe las fases como JSON de trace events de Chrome" << std::endl;
+	std::cout << "  --virtual-time Simula en tiempo virtual: no duerme y ejecuta cada rafaga de instrucciones normales en un solo paso" << std::endl;
+	std::cout << "  --trace        Con --virtual-time, muestra el estado antes de cada instruccion en lugar de una vez por quantum" << std::endl;
+	std::cout << "  --deterministic  Tiempo virtual con semilla 0: cada decision depende solo del reloj virtual y de la semilla" << std::endl;
+	std::cout << "  --seed N       Como --deterministic, con la semilla N para los tiempos de servicio de los dispositivos" << std::endl;
+	std::cout << "  --event-trace ARCHIVO  Escribe cada evento de planificacion (llegada, despacho, bloqueo, ...) con su tiempo" << std::endl;
+	std::cout << "  --gantt ARCHIVO  Al terminar, escribe la linea de tiempo de cada proceso y CPU como diagrama de Gantt (HTML con SVG)" << std::endl;
+	std::cout << "  --timeline-trace ARCHIVO  Al terminar, escribe la linea de tiempo como JSON de trace events de Chrome" << std::endl;
+	std::cout << "  --switch-cost S Cobra S segundos por cada cambio de contexto" << std::endl;
+	std::cout << "  --warmup-cost S Cobra S segundos de calentamiento de cache al proceso que entra, descontados de su quantum" << std::endl;
+	std::cout << "  --sticky       Mantiene al proceso cortado si el siguiente tiene su misma prioridad, para ahorrar cambios de contexto" << std::endl;
+	std::cout << "  --cpus N       Simula N CPUs en tiempo virtual: los procesos de un grupo corren juntos y cada uno prefiere su CPU de afinidad" << std::endl;
+	std::cout << "  --status-socket RUTA  Sirve el estado en vivo como JSON en un socket UNIX (curl --unix-socket RUTA http://localhost/)" << std::endl;
+	std::cout << "  --file ARCHIVO Usa ese archivo de procesos en lugar de preguntarlo" << std::endl;
+	std::cout << "  --policy rr|prioridad|edf|rm  Usa ese algoritmo en lugar de preguntarlo" << std::endl;
+}
+
+void UI::applyOptions() {
+	if (printProfile) {
+		Profiler::reset();
+		if (usePerfCounters) {
+			Profiler::enablePerfCounters();
+		}
+	}
+	if (scheduler) {
+		// en tiempo real siempre se muestra cada instruccion, como antes
+		scheduler->setInstructionTrace(!virtualTime || instructionTrace);
+		scheduler->setSeed(seed);
+		if (!eventTraceFile.empty()) {
+			eventTraceStream = new std::ofstream(eventTraceFile);
+			scheduler->setEventTrace(eventTraceStream);
+		}
+		scheduler->setContextSwitchCost(switchCost, warmupCost);
+		scheduler->setStickyEqualPriority(stickyEqualPriority);
+		scheduler->setCpuCount(cpuCount);
+		if (!statusSocket.empty()) {
+			StatusServer* server = new StatusServer(statusSocket);
+			if (server->start()) {
+				scheduler->setStatusServer(server);
+			} else {
+				delete server;
+			}
+		}
+		if (!ganttFile.empty() || !timelineTraceFile.empty()) {
+			scheduler->setTimeline(new Timeline());
+		}
+	}
+	if (!scheduler || !useNativeBackend) {
+		return;
+	}
+	if (!NativeBackend::isSupported()) {
+		std::cerr << "La ejecución nativa no está disponible en esta plataforma; se simularán los procesos." << std::endl;
+		return;
+	}
+	scheduler->setNativeBackend(new NativeBackend(pinnedCpu));
+}
+
 void UI::run() {
-	askForFileName();
-	askForScheduler();
+	// el reloj se configura antes de crear el planificador, que toma de el su tiempo de inicio
+	if (deterministic) {
+		virtualTime = true;
+	}
+	SimulationClock::setVirtual(virtualTime);
+	if (virtualTime) {
+		SimulationClock::reset();
+	}
+	if (filename.empty()) {
+		askForFileName();
+	}
+	if (policyName.empty()) {
+		askForScheduler();
+	} else {
+		scheduler = createScheduler(policyName);
+	}
+	applyOptions();
+}
+
+void UI::report() {
+	if (printProfile) {
+		Profiler::printSummary(std::cout);
+	}
+	if (!profileTraceFile.empty()) {
+		Profiler::writeChromeTrace(profileTraceFile);
+	}
+	const Timeline* timeline = scheduler ? scheduler->getTimeline() : nullptr;
+	if (timeline && !ganttFile.empty()) {
+		timeline->writeGantt(ganttFile);
+	}
+	if (timeline && !timelineTraceFile.empty()) {
+		timeline->writeChromeTrace(timelineTraceFile);
+	}
 }
\ No newline at end of file
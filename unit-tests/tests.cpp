@@ -4,7 +4,21 @@
 #include <ui.h>
 #include <scheduler.h>
 #include <fileParser.h>
+#include <profiler.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
 #include <sstream>
+#include <thread>
+#ifdef _WINDOWS32
+  #include <windows.h>
+#else
+  #include <unistd.h>
+#endif
 
 // Color Terminal Output Library
 // MIT Licensed Library
@@ -90,6 +104,11 @@ class Tests {
     Tests();
     /// @brief Metodo abstracto por implementar en las clases hijas.
     virtual void runAllTests() = 0; 
+    /// @brief Revisa si pasaron todas las pruebas corridas hasta ahora.
+    /// @return true si no fallo ninguna; false si no.
+    bool allPassed() const {
+      return testsPassed == testsRun;
+    }
 };
 Tests::Tests() : testsRun(0), testsPassed(0) {}
 
@@ -106,6 +125,10 @@ class ProcessTests : public Tests {
 			testIOOperations();
 			testPriorityComparisons();
 			testQuantumManagement();
+			testInstructionProfile();
+			testMoveSemantics();
+			testCopyOnWrite();
+			testBurstExecution();
 
 			printTestSummary();
 		}
@@ -247,6 +270,219 @@ class ProcessTests : public Tests {
 
 			printTestResult(p.hasMoreInstrucions() == true, "Should have more instructions after not executing all");
 		}
+
+		void testInstructionProfile() {
+			color("yellow", "\nInstruction Profile Tests:", true);
+
+			Process p("test", 3);
+			const char* program[] = {"i1", "e/s", "e/s", "i2", "i3", "i4", "i5", "i6", "i7", "i8", "e/s", "e/s", "e/s", "e/s", "i9"};
+			int length = sizeof(program) / sizeof(program[0]);
+			for (int i = 0; i < length; i++) {
+				p.addInstruction(program[i]);
+			}
+
+			printTestResult(p.countIOInstructions(1) == 6, "Should count all IO instructions from the start");
+			printTestResult(p.countCPUInstructions(1) == 9, "Should count all CPU instructions from the start");
+			printTestResult(p.countIOInstructions(4) == 4 && p.countCPUInstructions(4) == 8, "Should count remaining instructions from an index");
+			printTestResult(p.countIOInstructions(length + 1) == 0, "Should count nothing past the last instruction");
+
+			// se compara contra el recorrido paso a paso para todas las posiciones y varias prioridades base
+			bool allMatch = true;
+			for (int base = -2; base <= 13; base++) {
+				for (int from = 1; from <= length + 1; from++) {
+					int expected = base;
+					for (int i = from; i <= length; i++) {
+						if (std::string(program[i - 1]) == "e/s") {
+							expected = std::max(Process::MIN_PRIORITY, expected - 1);
+						} else {
+							expected = std::min(Process::MAX_PRIORITY, expected + 1);
+						}
+					}
+					allMatch = allMatch && p.projectPriority(base, from) == expected;
+				}
+			}
+			printTestResult(allMatch, "Projected priority should match a step by step recalculation at every index");
+
+			Process copy(p);
+			printTestResult(copy.projectPriority(3, 1) == p.projectPriority(3, 1), "Copies should keep the instruction profile");
+			p.addInstruction("e/s");
+			printTestResult(p.countIOInstructions(1) == 7, "Profile should refresh after adding instructions");
+		}
+
+		void testMoveSemantics() {
+			color("yellow", "\nMove Semantics Tests:", true);
+
+			Process source("source", 2);
+			source.addInstruction("i1");
+			source.addInstruction("e/s");
+			source.setCommand("true");
+			source.countIOInstructions(1);
+			const int* instructions = source.getInstructionIds();
+
+			Process moved(std::move(source));
+			printTestResult(moved.getInstructionIds() == instructions && moved.getName() == "source" && moved.getCommand() == "true",
+				"Move constructor should take the instructions without copying them");
+			printTestResult(moved.countIOInstructions(1) == 1 && moved.projectPriority(2, 1) == 2, "Moved process should keep its instruction profile");
+
+			Process target("target", 5);
+			target.addInstruction("i1");
+			target = std::move(moved);
+			printTestResult(target.getInstructionIds() == instructions && target.getPriority() == 2, "Move assignment should take the instructions without copying them");
+
+			Process copy(source);
+			printTestResult(copy.getInstructionCount() == 0 && !copy.hasMoreInstrucions(), "Copying a moved-from process should give a process without instructions");
+		}
+
+		void testCopyOnWrite() {
+			color("yellow", "\nCopy-On-Write Tests:", true);
+
+			Process original("original", 3);
+			original.addInstruction("i1");
+			original.addInstruction("e/s");
+			original.addInstruction("e/s");
+
+			Process copy(original);
+			printTestResult(copy.getProgram() == original.getProgram(), "Copy should share the program instead of copying it");
+			Process assigned;
+			assigned = copy;
+			printTestResult(assigned.getProgram() == original.getProgram(), "Copy assignment should share the program too");
+
+			copy.addInstruction("i2");
+			printTestResult(copy.getProgram() != original.getProgram(), "Adding an instruction should detach the copy");
+			printTestResult(original.getInstructionCount() == 3 && copy.getInstructionCount() == 4, "Original should not see the copy's new instruction");
+			printTestResult(*copy.getInstruction(4) == "i2" && original.getInstruction(4) == nullptr, "Copy should keep its own instructions");
+			printTestResult(original.projectPriority(3, 1) == 2 && copy.projectPriority(3, 1) == 3, "Each program should project its own priority");
+			printTestResult(assigned.getProgram() == original.getProgram(), "Other copies should keep sharing the original program");
+
+			Process empty1;
+			Process empty2("other", 1);
+			printTestResult(empty1.getProgram() == empty2.getProgram() && empty1.getInstructionIds() == nullptr,
+				"Processes without instructions should share the empty program");
+		}
+
+		void testBurstExecution() {
+			color("yellow", "\nBurst Execution Tests:", true);
+
+			SimulationClock::setVirtual(true);
+			SimulationClock::reset();
+			Process burst("burst", 1);
+			const char* instructions[] = {"i1", "i2", "i3", "e/s", "e/s", "i4", "i5", "i6", "i7"};
+			for (const char* instruction : instructions) {
+				burst.addInstruction(instruction);
+			}
+			burst.setQuantum(5);
+			printTestResult(burst.executeBurst() == 3 && burst.getInstructionIndex() == 4, "Burst should stop before the next I/O instruction");
+			printTestResult(burst.getQuantum() == 2 && SimulationClock::now() == 3, "Burst should charge the quantum and the clock in one step");
+			printTestResult(burst.executeBurst() == 0, "Burst should not run I/O instructions");
+
+			burst.executeNextInstruction();
+			burst.finishIO();
+			burst.setQuantum(2.5);
+			printTestResult(burst.executeBurst() == 2 && burst.getInstructionIndex() == 8, "Burst should stop at the first instruction that does not fit in the quantum");
+			burst.setQuantum(5);
+			printTestResult(burst.executeBurst() == 2 && burst.getState() == ProcessState::FINISHED, "Burst reaching the end should finish the process");
+
+			// la rafaga deja el proceso igual que ejecutar instruccion por instruccion
+			Process stepped("stepped", 1);
+			for (int i = 0; i < 7; i++) {
+				stepped.addInstruction(InstructionDictionary::intern("i1"), i % 2 == 0 ? 0.5 : 1.25);
+			}
+			Process batched = stepped;
+			stepped.setQuantum(4);
+			batched.setQuantum(4);
+			while (stepped.getQuantum() >= stepped.getInstructionCost(stepped.getInstructionIndex())) {
+				stepped.executeNextInstruction();
+			}
+			batched.executeBurst();
+			printTestResult(batched.getInstructionIndex() == stepped.getInstructionIndex() && batched.getQuantum() == stepped.getQuantum(),
+				"Burst should match executing the same instructions one by one");
+			SimulationClock::setVirtual(false);
+		}
+};
+
+class InstructionDictionaryTests : public Tests {
+  public:
+    void runAllTests() override {
+      color("cyan", "\n=== InstructionDictionary Class Tests ===", true);
+
+      testInterning();
+      testSharing();
+      testConcurrentInterning();
+
+      printTestSummary();
+    }
+
+    void testInterning() {
+      color("yellow", "\nInterning Tests:", true);
+
+      printTestResult(InstructionDictionary::intern("e/s") == InstructionDictionary::IO, "IO instructions should have a fixed ID");
+      int first = InstructionDictionary::intern("instruccion dict 1");
+      int again = InstructionDictionary::intern(std::string("instruccion ") + "dict 1");
+      int other = InstructionDictionary::intern("instruccion dict 2");
+      printTestResult(first == again && first != other, "Equal texts should share an ID and different texts should not");
+      printTestResult(InstructionDictionary::getText(first) == "instruccion dict 1" && InstructionDictionary::getText(InstructionDictionary::IO) == "e/s",
+        "IDs should map back to their text");
+
+      int size = InstructionDictionary::getSize();
+      for (int i = 0; i < 3000; i++) {
+        InstructionDictionary::intern("dict grow " + std::to_string(i));
+      }
+      const std::string& kept = InstructionDictionary::getText(first);
+      printTestResult(InstructionDictionary::getSize() == size + 3000 && InstructionDictionary::intern("dict grow 1234") == size + 1234,
+        "Dictionary should grow across storage chunks");
+      printTestResult(&kept == &InstructionDictionary::getText(first) && kept == "instruccion dict 1", "Texts should not move when the dictionary grows");
+
+      // pasa de los 16 bloques del directorio inicial: el directorio crece en lugar de llenarse
+      int directorySize = 16 * InstructionDictionary::CHUNK_SIZE;
+      int last = -1;
+      for (int i = InstructionDictionary::getSize(); i <= directorySize; i++) {
+        last = InstructionDictionary::intern("dict directory " + std::to_string(i));
+      }
+      printTestResult(last >= directorySize && InstructionDictionary::getText(last) == "dict directory " + std::to_string(last)
+        && &kept == &InstructionDictionary::getText(first), "Chunk directory should grow without moving the texts");
+    }
+
+    void testSharing() {
+      color("yellow", "\nSharing Tests:", true);
+
+      Process p("shared", 1);
+      p.addInstruction("instruccion dict 1");
+      p.addInstruction("e/s");
+      p.addInstruction(InstructionDictionary::intern("instruccion dict 1"));
+      Process copy(p);
+      printTestResult(p.getInstructionCount() == 3 && p.getInstructionId(1) == p.getInstructionId(3), "Repeated instructions should share an ID");
+      printTestResult(copy.getInstructionId(2) == InstructionDictionary::IO && copy.getInstruction(1) == p.getInstruction(1),
+        "Copies should point to the same dictionary texts");
+      printTestResult(p.getInstruction(0) == nullptr && p.getInstruction(4) == nullptr && p.getInstructionId(4) == -1, "Out of range positions should have no instruction");
+    }
+
+    void testConcurrentInterning() {
+      color("yellow", "\nConcurrent Interning Tests:", true);
+
+      const int threads = 4, words = 500;
+      int ids[threads][words];
+      std::thread workers[threads];
+      for (int t = 0; t < threads; t++) {
+        workers[t] = std::thread([&ids, t]() {
+          for (int i = 0; i < words; i++) {
+            // cada hilo interna las mismas palabras empezando en un punto distinto
+            int word = (i + t * 97) % words;
+            ids[t][word] = InstructionDictionary::intern("dict concurrent " + std::to_string(word));
+          }
+        });
+      }
+      for (int t = 0; t < threads; t++) {
+        workers[t].join();
+      }
+      bool consistent = true;
+      for (int i = 0; i < words; i++) {
+        for (int t = 1; t < threads; t++) {
+          consistent = consistent && ids[t][i] == ids[0][i];
+        }
+        consistent = consistent && InstructionDictionary::getText(ids[0][i]) == "dict concurrent " + std::to_string(i);
+      }
+      printTestResult(consistent, "Threads interning the same texts should get the same IDs");
+    }
 };
 
 class TimerTests : public Tests {
@@ -434,6 +670,13 @@ class FileParserTests : public Tests {
 
       testConstructor();
       testParseFile();
+      testParseCommand();
+      testParseCostModel();
+      testParseDevices();
+      testParseDeadlines();
+      testParseGroups();
+      testParseParallel();
+      testParseDiagnostics();
       testGetProcesses();
       testDestructor();
 
@@ -482,6 +725,344 @@ class FileParserTests : public Tests {
       remove(testFilename.c_str());
     }
 
+    void testParseCommand() {
+      color("yellow", "\nParse Command Tests:", true);
+
+      FileParser fp;
+      std::string testFilename = "testInput.txt";
+      std::ofstream outFile(testFilename);
+      outFile << "proceso Native 3\n";
+      outFile << "comando echo proceso listo\n";
+      outFile << "instruccion 1\n";
+      outFile << "fin proceso\n";
+      outFile.close();
+
+      fp.parseFile(testFilename);
+      Process process = fp.getProcesses()->getHead()->getData();
+      printTestResult(process.getName() == "Native" && process.getPriority() == 3, "Command line should not be mistaken for a process header");
+      printTestResult(process.getCommand() == "echo proceso listo", "Process command should be parsed");
+      printTestResult(process.getInstructionCount() == 1, "Command line should not be stored as an instruction");
+
+      remove(testFilename.c_str());
+    }
+
+    void testParseCostModel() {
+      color("yellow", "\nParse Cost Model Tests:", true);
+
+      FileParser fp;
+      std::string testFilename = "testInput.txt";
+      std::ofstream outFile(testFilename);
+      outFile << "costo instruccion rapida 0.5\n";
+      outFile << "costo e/s 0.25\n";
+      outFile << "costo predeterminado 0.75\n";
+      outFile << "latencia 4\n";
+      outFile << "costo sin valor\n";
+      outFile << "proceso Costs 3\n";
+      outFile << "instruccion rapida\n";
+      outFile << "otra instruccion\n";
+      outFile << "e/s\n";
+      outFile << "fin proceso\n";
+      outFile.close();
+
+      printTestResult(fp.parseFile(testFilename), "parseFile should accept a cost header");
+      const CostModel& model = fp.getCostModel();
+      printTestResult(model.getIOLatency() == 4 && model.getCPUCost() == 0.75, "Header should set the I/O latency and the default cost");
+      printTestResult(model.getCost(InstructionDictionary::intern("instruccion rapida")) == 0.5, "Header should set per-instruction costs");
+      printTestResult(model.getCost(InstructionDictionary::intern("sin")) == 0.75, "Invalid directives should be ignored");
+
+      Process process = fp.getProcesses()->getHead()->getData();
+      printTestResult(process.getInstructionCount() == 3, "Cost header should not be stored as instructions");
+      printTestResult(process.getInstructionCost(1) == 0.5 && process.getInstructionCost(2) == 0.75 && process.getInstructionCost(3) == 0.25,
+        "Costs should be resolved into the process program at load");
+      process.setQuantum(5);
+      process.executeNextInstruction();
+      printTestResult(process.getQuantum() == 4.5, "Executing an instruction should charge its resolved cost");
+
+      CostModel defaults;
+      printTestResult(defaults.getCost(InstructionDictionary::IO) == 1.5 && defaults.getCost(InstructionDictionary::intern("i1")) == 1
+        && defaults.getIOLatency() == 15, "Default cost model should keep the original costs");
+
+      remove(testFilename.c_str());
+    }
+
+    void testParseDevices() {
+      color("yellow", "\nParse Devices Tests:", true);
+
+      FileParser fp;
+      std::string testFilename = "testInput.txt";
+      std::ofstream outFile(testFilename);
+      outFile << "latencia 2\n";
+      outFile << "dispositivo disco 3 2 exponencial\n";
+      outFile << "dispositivo red 0.5\n";
+      outFile << "dispositivo roto -1\n";
+      outFile << "proceso Devices 3\n";
+      outFile << "e/s disco\n";
+      outFile << "e/s disco\n";
+      outFile << "e/s red\n";
+      outFile << "e/s\n";
+      outFile << "fin proceso\n";
+      outFile.close();
+
+      fp.parseFile(testFilename);
+      const CostModel& model = fp.getCostModel();
+      printTestResult(model.getDeviceCount() == 3 && model.findDevice("roto") == -1, "Valid devices should be declared and invalid ones rejected");
+      const DeviceSpec& disk = model.getDevice(model.findDevice("disco"));
+      printTestResult(disk.latency == 3 && disk.parallelism == 2 && disk.distribution == ServiceDistribution::EXPONENTIAL, "Device parameters should be parsed");
+      const DeviceSpec& network = model.getDevice(model.findDevice("red"));
+      printTestResult(network.parallelism == 1 && network.distribution == ServiceDistribution::FIXED, "Device parallelism and distribution should have defaults");
+      printTestResult(model.getDevice(CostModel::DEFAULT_DEVICE).latency == 2, "Latency directive should configure the default device");
+
+      Process process = fp.getProcesses()->getHead()->getData();
+      const Program* program = process.getProgram();
+      printTestResult(process.getInstructionId(1) == InstructionDictionary::IO && process.getInstructionId(3) == InstructionDictionary::IO,
+        "Device I/O lines should be the e/s instruction");
+      printTestResult(program->getDevice(1) == model.findDevice("disco") && program->getDevice(3) == model.findDevice("red")
+        && program->getDevice(4) == CostModel::DEFAULT_DEVICE, "Each I/O instruction should be resolved to its device at load");
+
+      remove(testFilename.c_str());
+    }
+
+    void testParseDeadlines() {
+      color("yellow", "\nParse Deadlines Tests:", true);
+
+      FileParser fp;
+      std::string testFilename = "testInput.txt";
+      std::ofstream outFile(testFilename);
+      outFile << "proceso Periodico 3 periodo 20\n";
+      outFile << "instruccion 1\n";
+      outFile << "fin proceso\n";
+      outFile << "proceso ConPlazo 2 plazo 15 periodo 30\n";
+      outFile << "instruccion 1\n";
+      outFile << "fin proceso\n";
+      outFile << "proceso Roto 1 plazo -4\n";
+      outFile << "instruccion 1\n";
+      outFile << "fin proceso\n";
+      outFile.close();
+
+      fp.parseFile(testFilename);
+      SinglyLinkedList<Process>* processes = fp.getProcesses();
+      printTestResult(processes->getSize() == 3, "Processes with real-time fields should be parsed");
+      Process broken = processes->getHead()->getData();
+      Process withDeadline = processes->getHead()->getNext()->getData();
+      Process periodic = processes->getHead()->getNext()->getNext()->getData();
+      printTestResult(withDeadline.getDeadline() == 15 && withDeadline.getPeriod() == 30, "Deadline and period should be parsed");
+      printTestResult(periodic.getDeadline() == 20 && periodic.getPeriod() == 20, "A periodic process should default its deadline to its period");
+      printTestResult(broken.getDeadline() == 0 && broken.getPriority() == 1, "Invalid fields should be ignored");
+
+      remove(testFilename.c_str());
+    }
+
+    void testParseGroups() {
+      color("yellow", "\nParse Groups Tests:", true);
+
+      FileParser fp;
+      std::string testFilename = "testInput.txt";
+      std::ofstream outFile(testFilename);
+      outFile << "proceso Cliente 2 grupo web afinidad 1\n";
+      outFile << "instruccion 1\n";
+      outFile << "fin proceso\n";
+      outFile << "proceso Servidor 2 grupo web plazo 10\n";
+      outFile << "instruccion 1\n";
+      outFile << "fin proceso\n";
+      outFile << "proceso Suelto 1 afinidad -3\n";
+      outFile << "instruccion 1\n";
+      outFile << "fin proceso\n";
+      outFile.close();
+
+      fp.parseFile(testFilename);
+      SinglyLinkedList<Process>* processes = fp.getProcesses();
+      printTestResult(processes->getSize() == 3, "Processes with group and affinity fields should be parsed");
+      Process loose = processes->getHead()->getData();
+      Process server = processes->getHead()->getNext()->getData();
+      Process client = processes->getHead()->getNext()->getNext()->getData();
+      printTestResult(client.getGroup() == "web" && client.getAffinity() == 1, "Group and affinity should be parsed");
+      printTestResult(server.getGroup() == "web" && server.getAffinity() == -1 && server.getDeadline() == 10,
+        "Group should combine with other fields and affinity should default to none");
+      printTestResult(loose.getGroup().empty() && loose.getAffinity() == -1, "Invalid affinity should be ignored");
+
+      remove(testFilename.c_str());
+    }
+
+    /// @brief Compara dos listas de procesos campo por campo, instrucciones incluidas
+    static bool sameProcesses(SinglyLinkedList<Process>& first, SinglyLinkedList<Process>& second) {
+      if (first.getSize() != second.getSize()) {
+        return false;
+      }
+      SinglyLinkedListNode<Process>* a = first.getHead();
+      SinglyLinkedListNode<Process>* b = second.getHead();
+      for (; a && b; a = a->getNext(), b = b->getNext()) {
+        const Process& p = *a->getPData();
+        const Process& q = *b->getPData();
+        if (p.getName() != q.getName() || p.getPriority() != q.getPriority() || p.getInstructionCount() != q.getInstructionCount()
+          || p.getCommand() != q.getCommand() || p.getGroup() != q.getGroup() || p.getDeadline() != q.getDeadline()) {
+          return false;
+        }
+        for (int i = 1; i <= p.getInstructionCount(); i++) {
+          if (p.getInstructionId(i) != q.getInstructionId(i) || p.getInstructionCost(i) != q.getInstructionCost(i)) {
+            return false;
+          }
+        }
+      }
+      return true;
+    }
+
+    /// @brief Compara los diagnosticos y contadores de dos lecturas
+    /// @return true si son iguales, en el mismo orden
+    bool sameDiagnostics(const FileParser& first, const FileParser& second) {
+      if (first.getErrorCount() != second.getErrorCount() || first.getWarningCount() != second.getWarningCount()
+        || first.getDiscardedCount() != second.getDiscardedCount() || first.getLineCount() != second.getLineCount()
+        || first.getDiagnostics().getSize() != second.getDiagnostics().getSize()) {
+        return false;
+      }
+      auto b = second.getDiagnostics().begin();
+      for (const ParseDiagnostic& a : first.getDiagnostics()) {
+        if (a.line != b->line || a.error != b->error || a.message != b->message) {
+          return false;
+        }
+        ++b;
+      }
+      return true;
+    }
+
+    /// @brief Lee un archivo con parseFile y con parseFileParallel en varias cantidades de hilos
+    /// @return true si todas las cargas paralelas dan lo mismo que parseFile, diagnosticos incluidos
+    bool parallelMatches(const std::string& filename) {
+      FileParser sequential;
+      sequential.parseFile(filename);
+      int threadCounts[] = {0, 1, 2, 3, 7, 64};
+      for (int threads : threadCounts) {
+        FileParser parallel;
+        if (!parallel.parseFileParallel(filename, threads) || !sameProcesses(*sequential.getProcesses(), *parallel.getProcesses())
+          || parallel.getCostModel().getIOLatency() != sequential.getCostModel().getIOLatency() || !sameDiagnostics(sequential, parallel)) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    void testParseParallel() {
+      color("yellow", "\nParallel Parse Tests:", true);
+
+      std::string testFilename = "testInput.txt";
+      std::ofstream outFile(testFilename);
+      outFile << "latencia 3\n";
+      outFile << "costo instruccion lenta 2\n";
+      for (int i = 0; i < 400; i++) {
+        outFile << "proceso p" << i << " " << i % 10 << (i % 7 == 0 ? " grupo g plazo 12" : "") << "\n";
+        if (i % 5 == 0) {
+          outFile << "comando echo proceso " << i << "\n";
+        }
+        for (int j = 0; j < i % 13; j++) {
+          outFile << (j % 4 == 0 ? "e/s" : j % 3 == 0 ? "instruccion lenta" : "instruccion " + std::to_string(j)) << "\n";
+        }
+        // algunos procesos no se cierran: el siguiente encabezado los descarta
+        if (i % 17 != 0) {
+          outFile << "fin proceso\n";
+        }
+      }
+      outFile.close();
+      printTestResult(parallelMatches(testFilename), "Parallel load should give the same processes, in the same order, for any thread count");
+      printTestResult(parallelMatches("database/pruebas.txt") && parallelMatches("database/enrique.txt"), "Parallel load should match on the sample workloads");
+
+      // una directiva entre procesos cambia el costo de los que siguen, asi que el resto se lee en orden
+      outFile.open(testFilename);
+      for (int i = 0; i < 50; i++) {
+        outFile << "proceso q" << i << " 1\ninstruccion\nfin proceso\n";
+        if (i == 30) {
+          outFile << "costo predeterminado 4\n";
+        }
+      }
+      outFile.close();
+      FileParser parallel;
+      parallel.parseFileParallel(testFilename, 4);
+      printTestResult(parallelMatches(testFilename) && parallel.getProcesses()->getHead()->getData().getInstructionCost(1) == 4,
+        "Cost directives between processes should apply to the processes after them");
+
+      FileParser missing;
+      std::stringstream errors;
+      std::streambuf* oldCerr = std::cerr.rdbuf(errors.rdbuf());
+      bool opened = missing.parseFileParallel("noExiste.txt", 4);
+      std::cerr.rdbuf(oldCerr);
+      printTestResult(!opened, "Parallel load should fail on a missing file");
+
+      remove(testFilename.c_str());
+    }
+
+    void testParseDiagnostics() {
+      color("yellow", "\nParse Diagnostics Tests:", true);
+
+      std::string testFilename = "testInput.txt";
+      std::ofstream outFile(testFilename);
+      outFile << "latencia rapida\n";                  // 1: directiva invalida
+      outFile << "proceso bueno 3\n";                  // 2
+      outFile << "e/s disco\n";                        // 3: dispositivo desconocido
+      outFile << "fin proceso\n";                      // 4
+      outFile << "proceso malo x9\n";                  // 5: prioridad invalida
+      outFile << "instruccion\n";
+      outFile << "comando echo proceso\n";
+      outFile << "fin proceso\n";                      // 8
+      outFile << "suelta\n";                           // 9: fuera de un proceso
+      outFile << "\n";
+      outFile << "proceso abierto 1\n";                // 11: sin fin proceso
+      outFile << "instruccion\n";
+      outFile << "proceso otro 2 plazo -1\n";          // 13: campo invalido
+      outFile << "instruccion\n";
+      outFile << "fin proceso\n";
+      outFile << "fin proceso\n";                      // 16: sin proceso abierto
+      outFile << "proceso\n";                          // 17: sin nombre
+      outFile << "proceso final 4\n";                  // 18: sin fin proceso al final del archivo
+      outFile << "instruccion\n";
+      outFile.close();
+
+      FileParser fp;
+      bool parsed = false;
+      try {
+        parsed = fp.parseFile(testFilename);
+      } catch (...) {
+        parsed = false;
+      }
+      printTestResult(parsed, "Malformed headers should not throw");
+
+      long long expectedLines[] = {1, 3, 5, 9, 11, 13, 16, 17, 18};
+      bool expectedErrors[] = {false, false, true, false, true, false, false, true, true};
+      bool matches = fp.getDiagnostics().getSize() == 9;
+      int index = 0;
+      for (const ParseDiagnostic& diagnostic : fp.getDiagnostics()) {
+        matches = matches && index < 9 && diagnostic.line == expectedLines[index] && diagnostic.error == expectedErrors[index];
+        index++;
+      }
+      printTestResult(matches, "Diagnostics should be reported in file order with their line numbers");
+      printTestResult(fp.getErrorCount() == 4 && fp.getWarningCount() == 5 && fp.getDiscardedCount() == 4 && fp.getLineCount() == 19,
+        "Errors, warnings, discarded processes and lines should be counted");
+
+      SinglyLinkedList<Process>* processes = fp.getProcesses();
+      bool kept = processes->getSize() == 2 && processes->getHead()->getData().getName() == "otro"
+        && processes->getHead()->getNext()->getData().getName() == "bueno"
+        && processes->getHead()->getNext()->getData().getInstructionCount() == 1;
+      printTestResult(kept, "Only well-formed processes should be kept, warnings included");
+
+      std::stringstream summary;
+      fp.printDiagnostics(summary, 2);
+      printTestResult(summary.str().find("4 errores, 5 advertencias") != std::string::npos
+        && summary.str().find("(7 diagnosticos mas)") != std::string::npos, "The summary should count the diagnostics it does not print");
+      printTestResult(parallelMatches(testFilename), "Parallel load should report the same diagnostics");
+
+      // muchos problemas: solo se guardan los primeros, pero se cuentan todos
+      outFile.open(testFilename);
+      for (int i = 0; i < FileParser::MAX_DIAGNOSTICS + 500; i++) {
+        outFile << "proceso p" << i << " no\ninstruccion\nfin proceso\n";
+      }
+      outFile.close();
+      FileParser many;
+      many.parseFileParallel(testFilename, 4);
+      printTestResult(many.getErrorCount() == FileParser::MAX_DIAGNOSTICS + 500 && many.getDiagnostics().getSize() == FileParser::MAX_DIAGNOSTICS
+        && many.getDiagnostics().begin()->line == 1 && many.getProcesses()->getSize() == 0,
+        "Only the first diagnostics should be kept, but all of them counted");
+      printTestResult(parallelMatches(testFilename), "Parallel load should keep the same first diagnostics");
+
+      remove(testFilename.c_str());
+    }
+
     void testGetProcesses() {
       color("yellow", "\nGet Processes Tests:", true);
 
@@ -502,6 +1083,12 @@ class FileParserTests : public Tests {
     }
 };
 
+/// @brief Round Robin que expone fillRound, para probar una ronda sin correr la simulacion.
+class RoundProbe : public RoundRobin {
+  public:
+    using Scheduler::fillRound;
+};
+
 class SchedulerTests : public Tests {
   public:
     void runAllTests() override {
@@ -511,6 +1098,14 @@ class SchedulerTests : public Tests {
       testAddAndRemoveProcesses();
       testStateTransitions();
       testExecutionCycle();
+      testRuntimeSubmission();
+      testBatchAdmission();
+      testLatencyTracking();
+      testIODevices();
+      testBatchedExecution();
+      testContextSwitches();
+      testDeadlineScheduling();
+      testMultiCore();
       testDestructor();
 
       printTestSummary();
@@ -585,6 +1180,495 @@ class SchedulerTests : public Tests {
       delete p;
     }
 
+    void testRuntimeSubmission() {
+      color("yellow", "\nRuntime Submission Tests:", true);
+
+      // varios productores contra un consumidor: no se pierde nada y cada productor conserva su orden FIFO
+      MPSCQueue<int> queue;
+      const int producers = 4;
+      const int perProducer = 2500;
+      std::thread threads[producers];
+      for (int t = 0; t < producers; t++) {
+        threads[t] = std::thread([&queue, t, perProducer]() {
+          for (int i = 0; i < perProducer; i++) {
+            queue.push(t * perProducer + i);
+          }
+        });
+      }
+      int received = 0;
+      int lastSeen[producers] = {-1, -1, -1, -1};
+      bool ordered = true;
+      while (received < producers * perProducer) {
+        int value;
+        if (queue.tryPop(value)) {
+          int producer = value / perProducer;
+          ordered = ordered && value % perProducer > lastSeen[producer];
+          lastSeen[producer] = value % perProducer;
+          received++;
+        }
+      }
+      for (int t = 0; t < producers; t++) {
+        threads[t].join();
+      }
+      printTestResult(received == producers * perProducer && queue.isEmpty(), "MPSC queue should deliver every pushed element exactly once");
+      printTestResult(ordered, "MPSC queue should keep each producer's FIFO order");
+
+      RoundRobin rrScheduler;
+      Process submitted("Submitted", 1);
+      rrScheduler.submitProcess(submitted);
+      printTestResult(rrScheduler.hasUnfinishedProcesses() == false, "Submitted processes should not be visible before the next scheduling point");
+      printTestResult(rrScheduler.admitSubmittedProcesses() == 1, "Scheduler should admit submitted processes");
+      printTestResult(rrScheduler.hasUnfinishedProcesses() == true, "Admitted processes should be ready to run");
+
+      // el planificador corre en su hilo mientras otros hilos le inyectan procesos
+      RoundRobin liveScheduler;
+      liveScheduler.openSubmissions();
+      std::stringstream buffer;
+      std::streambuf* oldCout = std::cout.rdbuf(buffer.rdbuf());
+      std::thread runner([&liveScheduler]() { liveScheduler.run(); });
+      for (int t = 0; t < producers; t++) {
+        threads[t] = std::thread([&liveScheduler, t]() {
+          for (int i = 0; i < 50; i++) {
+            liveScheduler.submitProcess(Process("Live" + std::to_string(t) + "_" + std::to_string(i), i % 10));
+          }
+        });
+      }
+      for (int t = 0; t < producers; t++) {
+        threads[t].join();
+      }
+      liveScheduler.closeSubmissions();
+      runner.join();
+      std::cout.rdbuf(oldCout);
+      printTestResult(!liveScheduler.hasPendingSubmissions() && !liveScheduler.hasUnfinishedProcesses(), "Live scheduler should drain every submission and stop once submissions close");
+
+      // sin procesos listos el planificador espera los envios bloqueado, no girando sobre un CPU
+      RoundRobin idleScheduler;
+      idleScheduler.openSubmissions();
+      std::clock_t cpuStart = std::clock();
+      runner = std::thread([&idleScheduler]() { idleScheduler.run(); });
+      std::this_thread::sleep_for(std::chrono::milliseconds(300));
+      idleScheduler.closeSubmissions();
+      runner.join();
+      double cpuSeconds = double(std::clock() - cpuStart) / CLOCKS_PER_SEC;
+      printTestResult(cpuSeconds < 0.1, "Idle scheduler should block while waiting for submissions");
+    }
+
+    /// @brief Obtiene el orden en que el planificador despacha sus procesos, sin ejecutarlos.
+    std::string dispatchOrder(Scheduler& scheduler) {
+      std::string order;
+      for (scheduler.schedule(); scheduler.getCurrent(); scheduler.schedule()) {
+        order += scheduler.getCurrent()->getName() + " ";
+      }
+      return order;
+    }
+
+    void testBatchAdmission() {
+      color("yellow", "\nBatch Admission Tests:", true);
+
+      SinglyLinkedList<Process> first, second;
+      int priorities[] = {3, 1, 3, 7, 1, 3, 9, 0, 7, 3};
+      for (int i = 0; i < 10; i++) {
+        Process process("p" + std::to_string(i), priorities[i]);
+        process.addInstruction(i % 3 == 0 ? "e/s" : "i1");
+        (i < 6 ? first : second).insertTail(process);
+      }
+
+      Priority oneByOne, batched;
+      for (SinglyLinkedList<Process>* list : {&first, &second}) {
+        for (const Process& process : *list) {
+          Process copy = process;
+          oneByOne.addProcess(&copy);
+        }
+        batched.addProcesses(*list);
+      }
+      std::string expected = dispatchOrder(oneByOne);
+      printTestResult(dispatchOrder(batched) == expected, "Batch admission should dispatch in the same order as adding one by one");
+
+      RoundRobin roundRobin;
+      roundRobin.addProcesses(first);
+      printTestResult(dispatchOrder(roundRobin).find("p0 ") == 0, "Default batch admission should add every process in order");
+    }
+
+    void testLatencyTracking() {
+      color("yellow", "\nLatency Tracking Tests:", true);
+
+      RoundRobin rrScheduler;
+      Process* first = new Process("First", 1);
+      first->addInstruction("instruction1");
+      Process* second = new Process("Second", 1);
+      second->addInstruction("instruction1");
+      rrScheduler.addProcess(first);
+      rrScheduler.addProcess(second);
+
+      std::stringstream buffer;
+      std::streambuf* oldCout = std::cout.rdbuf(buffer.rdbuf());
+      rrScheduler.run();
+      std::cout.rdbuf(oldCout);
+
+      const LatencyHistogram& response = rrScheduler.getResponseHistogram();
+      printTestResult(response.getCount() == 2, "Response time should be recorded once per process");
+      printTestResult(response.getMax() >= 900000, "Second process should wait for the first instruction before responding");
+      printTestResult(rrScheduler.getWaitingHistogram().getCount() == 2, "Waiting time should be recorded for every finished process");
+      printTestResult(buffer.str().find("=== Latencias (Round Robin) ===") != std::string::npos, "Run should end with the latency report for its policy");
+      printTestResult(buffer.str().find("p99.9") != std::string::npos, "Latency report should include tail percentiles");
+      delete first;
+      delete second;
+    }
+
+    void testIODevices() {
+      color("yellow", "\nI/O Device Tests:", true);
+
+      // dos canales con servicio fijo de 1 s: el tercer proceso espera a que se libere uno
+      IODevice device({"disco", 1, 2, ServiceDistribution::FIXED});
+      for (int i = 0; i < 3; i++) {
+        Process process("p" + std::to_string(i), 1);
+        process.getTimes().blockedSince = 0;
+        device.enqueue(process, 0);
+      }
+      printTestResult(device.getSize() == 3 && device.nextCompleted(0.5) == nullptr, "Operations should take the device latency");
+      Process* done = device.nextCompleted(1);
+      printTestResult(done && done->getName() == "p0", "Device should serve in arrival order");
+      device.remove(*done, 1);
+      printTestResult(device.peek() && device.peek()->getName() == "p1", "Peek should return the operation that finishes first");
+      device.remove(*device.peek(), 1);
+      printTestResult(device.nextCompleted(1.5) == nullptr && device.nextCompleted(2) != nullptr, "Queued operation should start when a channel frees up");
+      device.remove(*device.nextCompleted(2), 2);
+      printTestResult(device.getCompleted() == 3 && device.getSize() == 0, "Every operation should complete");
+      printTestResult(device.getUtilization(2) == 0.75, "Utilization should be busy time over channel time");
+      printTestResult(device.getQueueingHistogram().getCount() == 3 && device.getQueueingHistogram().getMax() >= 999000,
+        "Queueing delay should be recorded for every operation");
+
+      // dos procesos admitidos con el mismo nombre y prioridad se distinguen por su identificador
+      IODevice single({"cinta", 1, 1, ServiceDistribution::FIXED});
+      Process first("gemelo", 1);
+      Process second("gemelo", 1);
+      first.setId(1);
+      second.setId(2);
+      first.getTimes().blockedSince = 0;
+      second.getTimes().blockedSince = 0;
+      single.enqueue(first, 0);
+      single.enqueue(second, 0);
+      single.remove(second, 0.5);
+      Process* served = single.nextCompleted(1);
+      printTestResult(served && served->getId() == 1 && single.getSize() == 1 && single.getCompleted() == 0,
+        "Device should remove the process with the same id, not the first one with the same name");
+
+      // cada proceso se bloquea en el dispositivo de su instruccion de E/S
+      CostModel model;
+      int fast = model.addDevice({"rapido", 0, 1, ServiceDistribution::FIXED});
+      RoundRobin rrScheduler;
+      rrScheduler.setDevices(model);
+      Process* p = new Process("Device", 1);
+      p->addInstruction(InstructionDictionary::IO, 0, fast);
+      p->addInstruction(InstructionDictionary::IO, 0, fast);
+      rrScheduler.addProcess(p);
+      rrScheduler.schedule();
+      std::stringstream buffer;
+      std::streambuf* oldCout = std::cout.rdbuf(buffer.rdbuf());
+      rrScheduler.executeQuantum();
+      std::cout.rdbuf(oldCout);
+      printTestResult(rrScheduler.getDeviceCount() == 2 && rrScheduler.getDevice(fast).getCompleted() == 1
+        && rrScheduler.getDevice(CostModel::DEFAULT_DEVICE).getCompleted() == 0, "I/O should go to the device resolved for the instruction");
+      printTestResult(rrScheduler.getDevice(fast).getSize() == 0, "Finished I/O should leave the device queue");
+      std::stringstream report;
+      rrScheduler.printDeviceReport(report);
+      printTestResult(report.str().find("rapido: 1 operaciones") != std::string::npos, "Device report should include each device");
+      delete p;
+    }
+
+    void testBatchedExecution() {
+      color("yellow", "\nBatched Execution Tests:", true);
+
+      // la misma carga en tiempo virtual, con traza por instruccion y por rafagas, debe dar los mismos tiempos
+      SimulationClock::setVirtual(true);
+      double means[2];
+      double runTimes[2];
+      std::string outputs[2];
+      for (int traced = 0; traced < 2; traced++) {
+        SimulationClock::reset();
+        RoundRobin rrScheduler;
+        rrScheduler.setInstructionTrace(traced == 1);
+        for (int i = 0; i < 4; i++) {
+          Process process("p" + std::to_string(i), i);
+          for (int j = 0; j < 6 + i; j++) {
+            process.addInstruction(j == 3 || j == 4 ? "e/s" : "instruccion");
+          }
+          rrScheduler.addProcess(&process);
+        }
+        std::stringstream buffer;
+        std::streambuf* oldCout = std::cout.rdbuf(buffer.rdbuf());
+        rrScheduler.run();
+        std::cout.rdbuf(oldCout);
+        means[traced] = rrScheduler.getWaitingHistogram().getMean();
+        runTimes[traced] = SimulationClock::now();
+        outputs[traced] = buffer.str();
+      }
+      SimulationClock::setVirtual(false);
+      printTestResult(means[0] == means[1] && runTimes[0] == runTimes[1], "Batched execution should give the same virtual times as per-instruction execution");
+      printTestResult(runTimes[0] > 0, "Virtual time should advance without sleeping");
+      size_t batchedLines = std::count(outputs[0].begin(), outputs[0].end(), '\n');
+      size_t tracedLines = std::count(outputs[1].begin(), outputs[1].end(), '\n');
+      printTestResult(batchedLines < tracedLines, "Batched execution should present the state once per quantum instead of per instruction");
+    }
+
+    /// @brief Corre en tiempo virtual tres procesos de la misma prioridad, solo con instrucciones normales.
+    /// El reloj virtual debe reiniciarse antes de crear el planificador.
+    /// @return El tiempo virtual que tomo la corrida
+    double runSwitchWorkload(Scheduler& scheduler, int instructions) {
+      for (int i = 0; i < 3; i++) {
+        Process process("p" + std::to_string(i), 1);
+        for (int j = 0; j < instructions; j++) {
+          process.addInstruction("instruccion");
+        }
+        scheduler.addProcess(&process);
+      }
+      std::stringstream buffer;
+      std::streambuf* oldCout = std::cout.rdbuf(buffer.rdbuf());
+      scheduler.run();
+      std::cout.rdbuf(oldCout);
+      return SimulationClock::now();
+    }
+
+    void testContextSwitches() {
+      color("yellow", "\nContext Switch Tests:", true);
+
+      SimulationClock::setVirtual(true);
+      SimulationClock::reset();
+      RoundRobin freeScheduler;
+      freeScheduler.setInstructionTrace(false);
+      double freeTime = runSwitchWorkload(freeScheduler, 12);
+      SimulationClock::reset();
+      RoundRobin costlyScheduler;
+      costlyScheduler.setInstructionTrace(false);
+      costlyScheduler.setContextSwitchCost(0.5, 0.25);
+      double costlyTime = runSwitchWorkload(costlyScheduler, 12);
+      printTestResult(freeScheduler.getSwitchCount() > 3, "Round Robin should switch between processes on every quantum");
+      printTestResult(freeScheduler.getSwitchOverhead() == 0, "Switches should be free by default");
+      printTestResult(costlyScheduler.getSwitchOverhead() > 0 && costlyTime > freeTime + costlyScheduler.getSwitchCount() * 0.5,
+        "Switch and warmup costs should lengthen the run");
+      std::stringstream report;
+      costlyScheduler.printSwitchReport(report);
+      printTestResult(report.str().find("sin el costo de los cambios") != std::string::npos, "Switch report should show the throughput lost to switching");
+
+      SimulationClock::reset();
+      RoundRobin stickyScheduler;
+      stickyScheduler.setInstructionTrace(false);
+      stickyScheduler.setStickyEqualPriority(true);
+      double stickyTime = runSwitchWorkload(stickyScheduler, 12);
+      printTestResult(stickyScheduler.getSwitchCount() == 3, "Sticky Round Robin should not switch between equal priorities");
+      printTestResult(stickyTime == freeTime, "Sticky Round Robin should run the same instructions");
+
+      // con 1100 instrucciones cada proceso agota el quantum de 1024 una vez
+      SimulationClock::reset();
+      Priority priorityScheduler;
+      priorityScheduler.setInstructionTrace(false);
+      double priorityTime = runSwitchWorkload(priorityScheduler, 1100);
+      SimulationClock::reset();
+      Priority stickyPriority;
+      stickyPriority.setInstructionTrace(false);
+      stickyPriority.setStickyEqualPriority(true);
+      double stickyPriorityTime = runSwitchWorkload(stickyPriority, 1100);
+      SimulationClock::setVirtual(false);
+      printTestResult(priorityTime == 3300 && stickyPriorityTime == 3300, "Preempted priority processes should not repeat instructions");
+      printTestResult(stickyPriority.getSwitchCount() == 3 && priorityScheduler.getSwitchCount() > 3,
+        "Sticky priority scheduling should keep the preempted process on a tie");
+
+      // procesos distintos con el mismo nombre tambien cambian de contexto
+      SimulationClock::setVirtual(true);
+      SimulationClock::reset();
+      RoundRobin twinScheduler;
+      twinScheduler.setInstructionTrace(false);
+      for (int i = 0; i < 3; i++) {
+        Process process("gemelo", 1);
+        for (int j = 0; j < 12; j++) {
+          process.addInstruction("instruccion");
+        }
+        twinScheduler.addProcess(&process);
+      }
+      std::stringstream buffer;
+      std::streambuf* oldCout = std::cout.rdbuf(buffer.rdbuf());
+      twinScheduler.run();
+      std::cout.rdbuf(oldCout);
+      SimulationClock::setVirtual(false);
+      printTestResult(twinScheduler.getSwitchCount() == freeScheduler.getSwitchCount(), "Switches between processes with the same name should be charged");
+
+    }
+
+    /// @brief Crea un proceso de instrucciones normales con plazo y periodo
+    Process deadlineProcess(const std::string& name, int instructions, double deadline, double period) {
+      Process process(name, 1);
+      for (int i = 0; i < instructions; i++) {
+        process.addInstruction("instruccion");
+      }
+      process.setDeadline(deadline);
+      process.setPeriod(period);
+      return process;
+    }
+
+    void testDeadlineScheduling() {
+      color("yellow", "\nDeadline Scheduling Tests:", true);
+
+      // largo llega primero con un plazo holgado; corto llega despues con un plazo estricto
+      SimulationClock::setVirtual(true);
+      SimulationClock::reset();
+      EarliestDeadlineFirst edf;
+      edf.setInstructionTrace(false);
+      std::stringstream trace;
+      edf.setEventTrace(&trace);
+      Process longJob = deadlineProcess("largo", 20, 100, 0);
+      Process shortJob = deadlineProcess("corto", 5, 8, 0);
+      Process background = deadlineProcess("fondo", 5, 0, 0);
+      edf.addProcess(&background);
+      edf.addProcess(&longJob);
+      edf.addProcess(&shortJob);
+      std::stringstream buffer;
+      std::streambuf* oldCout = std::cout.rdbuf(buffer.rdbuf());
+      edf.run();
+      std::cout.rdbuf(oldCout);
+      printTestResult(trace.str().find("despacha corto") < trace.str().find("despacha largo")
+        && trace.str().find("despacha largo") < trace.str().find("despacha fondo"), "EDF should dispatch the earliest deadline first and processes without one last");
+      printTestResult(edf.getDeadlineCount() == 2 && edf.getDeadlineMisses() == 0, "EDF should meet feasible deadlines");
+
+      SimulationClock::reset();
+      RoundRobin rrScheduler;
+      rrScheduler.setInstructionTrace(false);
+      rrScheduler.addProcess(&background);
+      rrScheduler.addProcess(&longJob);
+      rrScheduler.addProcess(&shortJob);
+      oldCout = std::cout.rdbuf(buffer.rdbuf());
+      rrScheduler.run();
+      std::cout.rdbuf(oldCout);
+      printTestResult(rrScheduler.getDeadlineMisses() == 1 && rrScheduler.getLatenessHistogram().getCount() == 1,
+        "Round Robin should miss the tight deadline and record its lateness");
+      std::stringstream report;
+      rrScheduler.printDeadlineReport(report);
+      printTestResult(report.str().find("incumplidos: 1") != std::string::npos, "Deadline report should count misses");
+
+      // RM: el periodo mas corto va primero aunque su plazo sea mas lejano
+      SimulationClock::reset();
+      RateMonotonic rm;
+      rm.setInstructionTrace(false);
+      std::stringstream rmTrace;
+      rm.setEventTrace(&rmTrace);
+      Process slow = deadlineProcess("lento", 5, 0, 50);
+      Process fast = deadlineProcess("rapido", 5, 60, 10);
+      rm.addProcess(&slow);
+      rm.addProcess(&fast);
+      oldCout = std::cout.rdbuf(buffer.rdbuf());
+      rm.run();
+      std::cout.rdbuf(oldCout);
+      SimulationClock::setVirtual(false);
+      printTestResult(rmTrace.str().find("despacha rapido") < rmTrace.str().find("despacha lento"), "Rate monotonic should dispatch the shortest period first");
+      printTestResult(rm.getDeadlineCount() == 2 && !rm.hasUnfinishedProcesses(), "Rate monotonic should finish every process");
+    }
+
+    /// @brief Corre en tiempo virtual un Round Robin con varios CPUs sobre procesos de instrucciones normales.
+    /// @param names Los nombres de los procesos, en orden de llegada
+    /// @param groups El grupo de cada proceso ("" si no tiene)
+    /// @param affinities La afinidad de cada proceso (-1 si no tiene)
+    /// @return El tiempo virtual que tomo la corrida
+    double runMultiCoreWorkload(RoundRobin& scheduler, int count, const std::string* names, const std::string* groups,
+      const int* affinities, int instructions) {
+      for (int i = 0; i < count; i++) {
+        Process process(names[i], 1);
+        for (int j = 0; j < instructions; j++) {
+          process.addInstruction("instruccion");
+        }
+        process.setGroup(groups[i]);
+        process.setAffinity(affinities[i]);
+        scheduler.addProcess(&process);
+      }
+      std::stringstream buffer;
+      std::streambuf* oldCout = std::cout.rdbuf(buffer.rdbuf());
+      scheduler.run();
+      std::cout.rdbuf(oldCout);
+      return SimulationClock::now();
+    }
+
+    /// @brief Tiempo (en microsegundos) del primer despacho de un proceso en una traza de eventos, o -1 si no aparece
+    static long firstDispatch(const std::string& trace, const std::string& name) {
+      size_t position = trace.find(" despacha " + name + " ");
+      if (position == std::string::npos) {
+        return -1;
+      }
+      size_t lineStart = trace.rfind('\n', position);
+      return std::stol(trace.substr(lineStart == std::string::npos ? 0 : lineStart + 1));
+    }
+
+    void testMultiCore() {
+      color("yellow", "\nMulti-CPU Tests:", true);
+
+      std::string names[] = {"solo", "a1", "otro", "a2"};
+      std::string noGroups[] = {"", "", "", ""};
+      std::string groups[] = {"", "gang", "", "gang"};
+      int noAffinity[] = {-1, -1, -1, -1};
+      int affinities[] = {-1, -1, -1, 1};
+
+      SimulationClock::setVirtual(true);
+      SimulationClock::reset();
+      RoundRobin single;
+      single.setInstructionTrace(false);
+      double singleTime = runMultiCoreWorkload(single, 4, names, noGroups, noAffinity, 12);
+      SimulationClock::reset();
+      RoundRobin dual;
+      dual.setInstructionTrace(false);
+      dual.setCpuCount(2);
+      double dualTime = runMultiCoreWorkload(dual, 4, names, noGroups, noAffinity, 12);
+      printTestResult(dual.getCpuCount() == 2 && dualTime < singleTime && !dual.hasUnfinishedProcesses(),
+        "Two CPUs should finish every process sooner than one");
+
+      // con 3 CPUs, sin grupos la primera ronda es solo, a1 y otro; con el grupo a2 entra junto con a1
+      SimulationClock::reset();
+      RoundRobin gang;
+      gang.setInstructionTrace(false);
+      gang.setCpuCount(3);
+      std::stringstream trace;
+      gang.setEventTrace(&trace);
+      Timeline* timeline = new Timeline();
+      gang.setTimeline(timeline);
+      runMultiCoreWorkload(gang, 4, names, groups, affinities, 12);
+      printTestResult(firstDispatch(trace.str(), "a1") == 0 && firstDispatch(trace.str(), "a2") == 0,
+        "Members of a group should be dispatched together");
+      printTestResult(trace.str().find("despacha a2 cpu 1") != std::string::npos && trace.str().find("despacha a2 cpu 0") == std::string::npos
+        && trace.str().find("despacha a2 cpu 2") == std::string::npos, "A process should run on the CPU of its affinity");
+      printTestResult(gang.getMigrations() <= gang.getMigrationsWithoutAffinity(), "Affinity should not add migrations");
+
+      bool overlapping = false;
+      for (int i = 0; i < timeline->getIntervalCount(); i++) {
+        const TimelineInterval& first = timeline->getInterval(i);
+        for (int j = i + 1; j < timeline->getIntervalCount(); j++) {
+          const TimelineInterval& second = timeline->getInterval(j);
+          if (first.state == TimelineState::RUNNING && second.state == TimelineState::RUNNING && first.cpu == second.cpu
+            && first.start < second.end && second.start < first.end) {
+            overlapping = true;
+          }
+        }
+      }
+      printTestResult(!overlapping, "A CPU should run one process at a time");
+      std::stringstream report;
+      gang.printCpuReport(report);
+      SimulationClock::setVirtual(false);
+      printTestResult(report.str().find("CPU 2: utilizacion") != std::string::npos && report.str().find("evitadas") != std::string::npos,
+        "CPU report should show utilization per CPU and the migrations avoided");
+
+      // sin afinidad el proceso i de la ronda iria al CPU i: A (ultimo CPU 1) al 0 y B (ultimo CPU 0) al 1, dos migraciones
+      SimulationClock::reset();
+      RoundProbe probe;
+      probe.setCpuCount(2);
+      Process a("A", 1);
+      Process b("B", 1);
+      a.getTimes().lastCpu = 1;
+      b.getTimes().lastCpu = 0;
+      probe.addProcess(&a);
+      probe.addProcess(&b);
+      Process* assigned[2];
+      probe.fillRound(assigned);
+      printTestResult(assigned[0]->getName() == "B" && assigned[1]->getName() == "A" && probe.getMigrations() == 0
+        && probe.getMigrationsWithoutAffinity() == 2, "Migrations without affinity should compare each process with its position in the round");
+      delete assigned[0];
+      delete assigned[1];
+    }
+
     void testDestructor() {
       color("yellow", "\nDestructor Tests:", true);
 
@@ -598,28 +1682,1292 @@ class SchedulerTests : public Tests {
     }
 };
 
+class NativeBackendTests : public Tests {
+  public:
+    void runAllTests() override {
+      color("cyan", "\n=== NativeBackend Class Tests ===", true);
+
+      if (!NativeBackend::isSupported()) {
+        color("yellow", "Native backend not supported on this platform; skipping", true);
+        return;
+      }
+      testShortCommand();
+      testPreemption();
+      testSchedulerIntegration();
+
+      printTestSummary();
+    }
+
+    void testShortCommand() {
+      color("yellow", "\nShort Command Tests:", true);
+
+      NativeBackend backend;
+      Process p("Short", 1);
+      p.setCommand("exit 3");
+      p.setId(1);
+      printTestResult(backend.runSlice(p, 5) == true, "Short command should finish within its slice");
+      NativeJob* job = backend.getJobs()->getHead()->getPData();
+      printTestResult(job->finished && job->exitStatus == 3, "Exit status should be collected");
+      printTestResult(backend.runSlice(p, 5) == true && job->slices == 1, "Finished commands should not run again");
+
+      // otro proceso con el mismo nombre tiene su propio hijo
+      Process twin("Short", 1);
+      twin.setCommand("exit 4");
+      twin.setId(2);
+      printTestResult(backend.runSlice(twin, 5) == true && backend.getJobs()->getSize() == 2 && backend.getJobs()->getTail()->getData().exitStatus == 4,
+        "A process with the same name should run its own command");
+    }
+
+    void testPreemption() {
+      color("yellow", "\nPreemption Tests:", true);
+
+      NativeBackend backend(0);
+      Process p("Spin", 1);
+      p.setCommand("i=0; while [ $i -lt 200000 ]; do i=$((i+1)); done");
+      p.setId(1);
+      int slices = 0;
+      bool finished = false;
+      while (!finished && slices < 1000) {
+        finished = backend.runSlice(p, 0.02);
+        slices++;
+      }
+      NativeJob* job = backend.getJobs()->getHead()->getPData();
+      printTestResult(finished && slices > 1, "CPU-bound command should be stopped and resumed across several slices");
+      printTestResult(job->userSeconds + job->systemSeconds > 0, "CPU time should be gathered through rusage");
+      printTestResult(job->exitStatus == 0, "Preempted command should still finish successfully");
+    }
+
+    void testSchedulerIntegration() {
+      color("yellow", "\nScheduler Integration Tests:", true);
+
+      RoundRobin rrScheduler;
+      rrScheduler.setNativeBackend(new NativeBackend());
+      Process p("Native", 1);
+      p.setCommand("exit 0");
+      rrScheduler.addProcess(&p);
+
+      std::stringstream buffer;
+      std::streambuf* oldCout = std::cout.rdbuf(buffer.rdbuf());
+      rrScheduler.run();
+      std::cout.rdbuf(oldCout);
+
+      printTestResult(!rrScheduler.hasUnfinishedProcesses(), "Scheduler should finish processes run by the native backend");
+      printTestResult(buffer.str().find("Procesos terminados: 1") != std::string::npos, "Natively run process should reach the finished queue");
+      printTestResult(buffer.str().find("Ejecucion nativa") != std::string::npos, "Scheduler should print the native execution report");
+    }
+};
+
+/// @brief Tipo auxiliar que cuenta cuantas veces se copia o se mueve, para probar las inserciones sin temporales.
+struct CopyCounter {
+  static int copies;
+  static int moves;
+  int value;
+
+  CopyCounter(int newValue = 0) : value(newValue) {}
+  CopyCounter(int first, int second) : value(first + second) {}
+  CopyCounter(const CopyCounter& other) : value(other.value) { copies++; }
+  CopyCounter(CopyCounter&& other) : value(other.value) { moves++; }
+  CopyCounter& operator=(const CopyCounter& other) { value = other.value; copies++; return *this; }
+  CopyCounter& operator=(CopyCounter&& other) { value = other.value; moves++; return *this; }
+  bool operator<=(const CopyCounter& other) const { return value <= other.value; }
+  bool operator==(const CopyCounter& other) const { return value == other.value; }
+
+  static void reset() {
+    copies = 0;
+    moves = 0;
+  }
+};
+
+int CopyCounter::copies = 0;
+int CopyCounter::moves = 0;
+
+class SinglyLinkedListTests : public Tests {
+  public:
+    void runAllTests() override {
+      color("cyan", "\n=== SinglyLinkedList Class Tests ===", true);
+
+      testSort();
+      testSortBy();
+      testIterators();
+      testMoveInsertion();
+      testTailOperations();
+
+      printTestSummary();
+    }
+
+    bool isSorted(SinglyLinkedList<int>& list) {
+      SinglyLinkedListNode<int>* current = list.getHead();
+      while (current && current->getNext()) {
+        if (current->getData() > current->getNext()->getData()) {
+          return false;
+        }
+        current = current->getNext();
+      }
+      return true;
+    }
+
+    void testSort() {
+      color("yellow", "\nSort Tests:", true);
+
+      SinglyLinkedList<int> empty;
+      empty.sort();
+      printTestResult(empty.getSize() == 0 && empty.getHead() == nullptr, "Sorting an empty list should do nothing");
+
+      SinglyLinkedList<int> list;
+      unsigned int seed = 12345;
+      long long sum = 0;
+      for (int i = 0; i < 1000; i++) {
+        seed = seed * 1103515245 + 12345;
+        int value = (seed >> 16) % 100;
+        list.insertTail(value);
+        sum += value;
+      }
+      list.sort();
+      long long sortedSum = 0;
+      int count = 0;
+      for (SinglyLinkedListNode<int>* current = list.getHead(); current; current = current->getNext()) {
+        sortedSum += current->getData();
+        count++;
+      }
+      printTestResult(isSorted(list), "List should be sorted from smallest to biggest");
+      printTestResult(count == 1000 && list.getSize() == 1000 && sortedSum == sum, "Sorting should keep every element");
+
+      SinglyLinkedList<int> odd;
+      int values[] = {5, 3, 9, 1, 7};
+      for (int value : values) {
+        odd.insertTail(value);
+      }
+      odd.sort();
+      printTestResult(isSorted(odd) && odd.getAt(1)->getData() == 1 && odd.getAt(5)->getData() == 9, "Lists with an odd number of nodes should be sorted");
+    }
+
+    void testSortBy() {
+      color("yellow", "\nSortBy Tests:", true);
+
+      SinglyLinkedList<Process> processes;
+      for (int i = 0; i < 20; i++) {
+        processes.insertTail(Process("p" + std::to_string(i), i % 4));
+      }
+      SinglyLinkedListNode<Process>* firstNode = processes.getHead();
+      processes.sortBy([](const Process& a, const Process& b) { return a.getPriority() > b.getPriority(); });
+
+      bool stable = true;
+      int lastPriority = 4;
+      int lastIndex = -1;
+      for (SinglyLinkedListNode<Process>* current = processes.getHead(); current; current = current->getNext()) {
+        int priority = current->getPData()->getPriority();
+        int index = std::stoi(current->getPData()->getName().substr(1));
+        if (priority > lastPriority || (priority == lastPriority && index < lastIndex)) {
+          stable = false;
+        }
+        lastPriority = priority;
+        lastIndex = index;
+      }
+      printTestResult(stable, "sortBy should order by the comparator and keep ties in their original order");
+      bool relinked = false;
+      for (SinglyLinkedListNode<Process>* current = processes.getHead(); current; current = current->getNext()) {
+        relinked = relinked || (current == firstNode && current->getPData()->getName() == "p0");
+      }
+      printTestResult(relinked, "sortBy should relink nodes instead of copying data between them");
+    }
+
+    void testIterators() {
+      color("yellow", "\nIterator Tests:", true);
+
+      SinglyLinkedList<int> list;
+      printTestResult(list.begin() == list.end(), "Empty list should have begin equal to end");
+      for (int i = 1; i <= 5; i++) {
+        list.insertTail(i);
+      }
+      int sum = 0, count = 0;
+      for (int value : list) {
+        sum += value;
+        count++;
+      }
+      printTestResult(count == 5 && sum == 15, "Range-based for should visit every element in order");
+
+      for (int& value : list) {
+        value *= 10;
+      }
+      printTestResult(list.getHead()->getData() == 10 && list.getTail()->getData() == 50, "Mutable iterators should modify elements in place");
+
+      const SinglyLinkedList<int>& constList = list;
+      SinglyLinkedList<int>::const_iterator it = constList.begin();
+      it++;
+      printTestResult(*it == 20 && (++it).getNode() == list.getAt(3), "Const iterators should advance with pre and post increment");
+      SinglyLinkedList<int>::const_iterator converted = list.begin();
+      printTestResult(*converted == 10, "Mutable iterators should convert to const iterators");
+    }
+
+    void testMoveInsertion() {
+      color("yellow", "\nMove Insertion Tests:", true);
+
+      SinglyLinkedList<CopyCounter> list;
+      CopyCounter::reset();
+      list.insertTail(CopyCounter(1));
+      list.insertHead(CopyCounter(2));
+      printTestResult(CopyCounter::copies == 0 && CopyCounter::moves == 2, "Inserting temporaries should move them instead of copying");
+
+      CopyCounter::reset();
+      CopyCounter& tail = list.emplaceTail(3, 4);
+      CopyCounter& head = list.emplaceHead(5);
+      printTestResult(CopyCounter::copies == 0 && CopyCounter::moves == 0, "Emplacing should build the data in place");
+      printTestResult(&tail == list.getTail()->getPData() && tail.value == 7 && &head == list.getHead()->getPData() && list.getSize() == 4,
+        "Emplace should return the new head or tail data");
+
+      CopyCounter::reset();
+      SinglyLinkedList<CopyCounter> moved(std::move(list));
+      SinglyLinkedList<CopyCounter> assigned;
+      assigned = std::move(moved);
+      printTestResult(CopyCounter::copies == 0 && assigned.getSize() == 4 && list.getSize() == 0 && moved.getSize() == 0,
+        "Moving a list should transfer its nodes without copying");
+
+      SinglyLinkedList<Process> processes;
+      Process process("moved", 3);
+      process.addInstruction("i1");
+      process.addInstruction("e/s");
+      const int* instructions = process.getInstructionIds();
+      processes.insertTail(std::move(process));
+      printTestResult(processes.getHead()->getPData()->getInstructionIds() == instructions && processes.getHead()->getPData()->getName() == "moved",
+        "Moving a process into a list should keep its instructions");
+    }
+    void testTailOperations() {
+      color("yellow", "\nTail Tests:", true);
+
+      SinglyLinkedList<int> list;
+      printTestResult(list.getTail() == nullptr, "Empty list should have no tail");
+      list.insertHead(2);
+      printTestResult(list.getTail() == list.getHead(), "Inserting into an empty list should set the tail");
+      list.insertTail(3);
+      list.insertHead(1);
+      list.insertAfter(3, 4);
+      printTestResult(list.getTail()->getData() == 4 && list.getSize() == 4, "insertAfter the tail should move the tail");
+      list.deleteTail();
+      printTestResult(list.getTail()->getData() == 3 && list.getTail()->getNext() == nullptr, "deleteTail should move the tail back");
+      list.deleteByValue(3);
+      printTestResult(list.getTail()->getData() == 2, "Deleting the tail by value should update the tail");
+      list.insertTail(5);
+      list.deleteAt(3);
+      printTestResult(list.getTail()->getData() == 2, "Deleting the tail by position should update the tail");
+      list.deleteAfter(1);
+      printTestResult(list.getTail() == list.getHead() && list.getSize() == 1, "deleteAfter the tail's predecessor should update the tail");
+
+      SinglyLinkedList<int> unsorted;
+      int values[] = {4, 1, 3, 5, 2};
+      for (int value : values) {
+        unsorted.insertTail(value);
+      }
+      unsorted.sort();
+      printTestResult(unsorted.getTail()->getData() == 5, "Sorting should update the tail");
+      SinglyLinkedList<int> copy(unsorted);
+      copy.insertTail(6);
+      printTestResult(copy.getTail()->getData() == 6 && unsorted.getTail()->getData() == 5, "Copies should have their own tail");
+
+      SinglyLinkedList<std::string> queue;
+      for (int i = 0; i < 3; i++) {
+        queue.insertTail("job" + std::to_string(i));
+      }
+      std::string first = queue.popFront();
+      std::string second = queue.popFront();
+      std::string third = queue.popFront();
+      printTestResult(first == "job0" && second == "job1" && third == "job2", "insertTail and popFront should work as a FIFO queue");
+      printTestResult(queue.getHead() == nullptr && queue.getTail() == nullptr && queue.getSize() == 0, "Popping the last element should empty the list");
+      bool threw = false;
+      try {
+        queue.popFront();
+      } catch (const std::out_of_range&) {
+        threw = true;
+      }
+      printTestResult(threw, "popFront on an empty list should throw");
+      queue.insertTail("again");
+      printTestResult(queue.getHead() == queue.getTail() && queue.getHead()->getData() == "again", "An emptied list should be reusable");
+    }
+};
+
+class BinarySearchTreeTests : public Tests {
+  public:
+    void runAllTests() override {
+      color("cyan", "\n=== BinarySearchTree Class Tests ===", true);
+
+      testIterators();
+      testMoveInsertion();
+      testBulkLoad();
+      testDeepTrees();
+
+      printTestSummary();
+    }
+
+    void testIterators() {
+      color("yellow", "\nIterator Tests:", true);
+
+      BinarySearchTree<int> tree;
+      printTestResult(tree.begin() == tree.end() && tree.rbegin() == tree.rend(), "Empty tree should have begin equal to end");
+      int values[] = {50, 30, 70, 20, 40, 60, 80, 35, 45, 65};
+      for (int value : values) {
+        tree.insert(value);
+      }
+
+      bool ascending = true;
+      int count = 0, previous = -1;
+      for (int value : tree) {
+        ascending = ascending && value > previous;
+        previous = value;
+        count++;
+      }
+      printTestResult(ascending && count == 10, "In-order iterator should visit every node from smallest to biggest");
+
+      bool descending = true;
+      count = 0;
+      previous = 1000;
+      for (BinarySearchTree<int>::reverse_iterator it = tree.rbegin(); it != tree.rend(); ++it) {
+        descending = descending && *it < previous;
+        previous = *it;
+        count++;
+      }
+      printTestResult(descending && count == 10, "Reverse iterator should visit every node from biggest to smallest");
+      printTestResult(*tree.rbegin() == tree.getMax()->getData(), "Reverse iterator should start at the max");
+
+      const BinarySearchTree<int>& constTree = tree;
+      BinarySearchTree<int>::const_iterator it = constTree.begin();
+      BinarySearchTree<int>::const_iterator copy = it;
+      ++it;
+      printTestResult(*copy == 20 && *it == 30, "Copied iterators should advance independently");
+
+      // arbol degenerado: el iterador no depende de la recursion
+      BinarySearchTree<int> chain;
+      for (int i = 0; i < 2000; i++) {
+        chain.insert(i);
+      }
+      long long sum = 0;
+      for (int value : chain) {
+        sum += value;
+      }
+      printTestResult(sum == 1999LL * 2000 / 2, "Iterator should traverse deep trees");
+    }
+
+    void testMoveInsertion() {
+      color("yellow", "\nMove Insertion Tests:", true);
+
+      BinarySearchTree<CopyCounter> tree;
+      CopyCounter::reset();
+      tree.insert(CopyCounter(20));
+      tree.insert(CopyCounter(10));
+      CopyCounter& emplaced = tree.emplace(15, 15);
+      printTestResult(CopyCounter::copies == 0 && CopyCounter::moves == 2, "Inserting temporaries and emplacing should not copy");
+      printTestResult(&emplaced == tree.getMax()->getPData() && emplaced.value == 30 && tree.getSize() == 3, "Emplace should place the new data in BST order");
+
+      BinarySearchTree<Process> processes;
+      Process process("p", 4);
+      process.addInstruction("i1");
+      const int* instructions = process.getInstructionIds();
+      processes.insert(std::move(process));
+      printTestResult(processes.getRoot()->getPData()->getInstructionIds() == instructions, "Moving a process into the tree should keep its instructions");
+    }
+
+    void testBulkLoad() {
+      color("yellow", "\nBulk Load Tests:", true);
+
+      SinglyLinkedList<int> sorted;
+      for (int i = 1; i <= 15; i++) {
+        sorted.insertTail(i);
+      }
+      BinarySearchTree<int> tree;
+      tree.insert(100);
+      tree.buildFromSorted(sorted.begin(), sorted.end());
+      printTestResult(tree.getSize() == 15 && tree.getRoot()->getData() == 8, "Bulk load should replace the contents with a balanced tree");
+      bool ordered = true;
+      int expected = 1;
+      for (int value : tree) {
+        ordered = ordered && value == expected++;
+      }
+      printTestResult(ordered && tree.getMax()->getData() == 15, "Bulk loaded tree should keep the sorted order");
+      bool found = true;
+      for (int i = 1; i <= 15; i++) {
+        found = found && tree.search(i) && tree.search(i)->getData() == i;
+      }
+      printTestResult(found && !tree.search(16), "Every element should be found after a bulk load");
+      tree.insert(0);
+      tree.remove(8);
+      printTestResult(tree.getSize() == 15 && !tree.search(8) && tree.begin() != tree.end() && *tree.begin() == 0, "Bulk loaded tree should support inserts and removals");
+
+      BinarySearchTree<int> empty;
+      empty.buildFromSorted(sorted.begin(), sorted.begin());
+      printTestResult(empty.getRoot() == nullptr, "Bulk loading an empty range should leave an empty tree");
+
+      // prioridades iguales a ambos lados de la raiz
+      SinglyLinkedList<Process> ties;
+      const char* names[] = {"a", "b", "c", "d", "e", "f", "g"};
+      for (const char* name : names) {
+        ties.insertTail(Process(name, 5));
+      }
+      BinarySearchTree<Process> tieTree;
+      tieTree.buildFromSorted(std::make_move_iterator(ties.begin()), std::make_move_iterator(ties.end()));
+      bool allFound = true;
+      for (const char* name : names) {
+        BinarySearchTreeNode<Process>* node = tieTree.search(Process(name, 5));
+        allFound = allFound && node && node->getPData()->getName() == name;
+      }
+      printTestResult(allFound, "Equal keys should be found on both sides of the tree");
+      printTestResult(tieTree.getMax()->getPData()->getName() == "g", "Max should be the last element of the range among equal keys");
+      for (const char* name : names) {
+        tieTree.remove(Process(name, 5));
+      }
+      printTestResult(tieTree.getRoot() == nullptr, "Every equal key should be removable");
+    }
+
+    void testDeepTrees() {
+      color("yellow", "\nDeep Tree Tests:", true);
+
+      // cadena degenerada: cada valor nuevo es el menor y cuelga a la izquierda del anterior
+      const int depth = 10000;
+      BinarySearchTree<int> chain;
+      for (int i = depth; i > 0; i--) {
+        chain.insert(i);
+      }
+      printTestResult(chain.getSize() == depth, "Size should be kept without walking the tree");
+      printTestResult(chain.search(1) && chain.search(1)->getData() == 1 && !chain.search(0), "Search should reach the bottom of a degenerate tree");
+
+      BinarySearchTree<int> copy(chain);
+      printTestResult(copy.getSize() == depth && copy == chain, "Copies of degenerate trees should be equal to the original");
+      copy.remove(1);
+      printTestResult(!(copy == chain) && copy.getSize() == depth - 1 && !copy.search(1), "Removing the deepest node should work");
+
+      BinarySearchTree<int> assigned;
+      assigned = chain;
+      chain.remove(depth);
+      printTestResult(assigned.getRoot()->getData() == depth && chain.getRoot()->getData() == depth - 1, "Removing the root of a chain should promote its child");
+      chain.clear();
+      printTestResult(chain.getSize() == 0 && chain.getRoot() == nullptr, "Clearing a degenerate tree should empty it");
+
+      BinarySearchTree<int> twoChildren;
+      int values[] = {50, 30, 70, 60, 80, 65};
+      for (int value : values) {
+        twoChildren.insert(value);
+      }
+      twoChildren.remove(50);
+      bool ordered = true;
+      int previous = 0;
+      for (int value : twoChildren) {
+        ordered = ordered && value > previous;
+        previous = value;
+      }
+      printTestResult(ordered && twoChildren.getRoot()->getData() == 60 && twoChildren.getSize() == 5, "Removing a node with two children should promote its successor");
+    }
+};
+
+class BinaryHeapTests : public Tests {
+  public:
+    void runAllTests() override {
+      color("cyan", "\n=== BinaryHeap Class Tests ===", true);
+
+      testOrdering();
+      testComparison();
+      testRemoveAndCopy();
+
+      printTestSummary();
+    }
+
+    void testOrdering() {
+      color("yellow", "\nOrdering Tests:", true);
+
+      BinaryHeap<int> heap;
+      printTestResult(heap.isEmpty() && heap.getSize() == 0, "New heap should be empty");
+      int values[] = {50, 30, 70, 20, 40, 60, 80, 35, 45, 65, 20};
+      for (int value : values) {
+        heap.push(value);
+      }
+      printTestResult(heap.getSize() == 11 && heap.top() == 20, "Top should be the smallest element");
+
+      bool ascending = true;
+      int previous = -1;
+      while (!heap.isEmpty()) {
+        int value = heap.pop();
+        ascending = ascending && value >= previous;
+        previous = value;
+      }
+      printTestResult(ascending, "Popping should give the elements from smallest to biggest");
+
+      bool threw = false;
+      try {
+        heap.pop();
+      } catch (const std::out_of_range&) {
+        threw = true;
+      }
+      printTestResult(threw, "Popping an empty heap should throw");
+
+      for (int value = 0; value < 1000; value++) {
+        heap.push((value * 7919) % 1000);
+      }
+      bool sorted = true;
+      for (int expected = 0; expected < 1000; expected++) {
+        sorted = sorted && heap.pop() == expected;
+      }
+      printTestResult(sorted, "Heap should stay ordered after growing");
+    }
+
+    static bool greaterThan(const int& a, const int& b) {
+      return a > b;
+    }
+
+    void testComparison() {
+      color("yellow", "\nComparison Tests:", true);
+
+      BinaryHeap<int> heap(greaterThan);
+      for (int value = 0; value < 10; value++) {
+        heap.push(value);
+      }
+      printTestResult(heap.pop() == 9 && heap.pop() == 8, "Custom comparison should decide the top");
+
+      BinaryHeap<std::string> strings;
+      std::string moved = "movido";
+      strings.push(std::move(moved));
+      strings.push("a");
+      printTestResult(strings.top() == "a" && strings.getSize() == 2, "Heap should accept moved elements");
+    }
+
+    void testRemoveAndCopy() {
+      color("yellow", "\nRemove and Copy Tests:", true);
+
+      BinaryHeap<int> heap;
+      for (int value = 0; value < 20; value++) {
+        heap.push(value);
+      }
+      printTestResult(heap.remove(7) && !heap.remove(100), "Remove should only find existing elements");
+      printTestResult(heap.remove(0) && heap.top() == 1, "Removing the top should bring up the next one");
+
+      BinaryHeap<int> copy(heap);
+      copy.pop();
+      printTestResult(copy.getSize() == 17 && heap.getSize() == 18, "Copies should be independent");
+      bool ordered = true;
+      int previous = -1;
+      while (!heap.isEmpty()) {
+        int value = heap.pop();
+        ordered = ordered && value > previous && value != 7;
+        previous = value;
+      }
+      printTestResult(ordered, "Heap should stay ordered after removals");
+      copy.clear();
+      printTestResult(copy.isEmpty(), "Clear should empty the heap");
+    }
+};
+
+class LatencyHistogramTests : public Tests {
+  public:
+    void runAllTests() override {
+      color("cyan", "\n=== LatencyHistogram Class Tests ===", true);
+
+      testEmpty();
+      testPercentiles();
+      testMerge();
+
+      printTestSummary();
+    }
+
+    void testEmpty() {
+      color("yellow", "\nEmpty Histogram Tests:", true);
+
+      LatencyHistogram histogram;
+      printTestResult(histogram.getCount() == 0, "New histogram should be empty");
+      printTestResult(histogram.getPercentile(99) == 0 && histogram.getMean() == 0, "Empty histogram should report zeros");
+    }
+
+    void testPercentiles() {
+      color("yellow", "\nPercentile Tests:", true);
+
+      LatencyHistogram histogram;
+      for (unsigned long long value = 1; value <= 1000000; value++) {
+        histogram.record(value);
+      }
+      printTestResult(histogram.getCount() == 1000000, "Histogram should count every recorded value");
+      printTestResult(histogram.getMin() == 1 && histogram.getMax() == 1000000, "Histogram should track exact min and max");
+      bool accurate = true;
+      double percentiles[] = {50, 90, 99, 99.9};
+      for (double percentile : percentiles) {
+        double expected = percentile / 100.0 * 1000000;
+        double relativeError = ((double) histogram.getPercentile(percentile) - expected) / expected;
+        accurate = accurate && relativeError >= 0 && relativeError < 1.0 / 128;
+      }
+      printTestResult(accurate, "p50/p90/p99/p99.9 should be within 1/128 of the exact value");
+      printTestResult(histogram.getPercentile(100) == 1000000, "p100 should be the maximum");
+
+      LatencyHistogram small;
+      small.record(7);
+      small.record(7);
+      small.record(200);
+      printTestResult(small.getPercentile(50) == 7 && small.getPercentile(99.9) == 200, "Small values should be recorded exactly");
+    }
+
+    void testMerge() {
+      color("yellow", "\nMerge Tests:", true);
+
+      LatencyHistogram left, right, combined;
+      for (unsigned long long value = 0; value < 5000; value++) {
+        left.record(value * 3);
+        right.record(value * 1000 + 17);
+        combined.record(value * 3);
+        combined.record(value * 1000 + 17);
+      }
+      left.merge(right);
+      bool same = left.getCount() == combined.getCount() && left.getMin() == combined.getMin() && left.getMax() == combined.getMax();
+      for (double percentile = 0; percentile <= 100; percentile += 0.5) {
+        same = same && left.getPercentile(percentile) == combined.getPercentile(percentile);
+      }
+      printTestResult(same, "Merging two histograms should equal recording everything in one");
+    }
+};
+
+class ProfilerTests : public Tests {
+  public:
+    void runAllTests() override {
+      color("cyan", "\n=== Profiler Class Tests ===", true);
+
+      testCompilation();
+      testRecording();
+
+      printTestSummary();
+    }
+
+    void testCompilation() {
+      color("yellow", "\nCompilation Tests:", true);
+
+#ifdef SCHEDULER_PROFILING
+      printTestResult(Profiler::isEnabled(), "Profiler should be enabled when compiled with SCHEDULER_PROFILING");
+#else
+      printTestResult(!Profiler::isEnabled(), "Profiler should be disabled by default");
+      PROFILE_SCOPE(ProfilePhase::EXECUTE_QUANTUM);
+      printTestResult(!Profiler::writeChromeTrace("profileTest.json"), "Disabled profiler should not write traces");
+#endif
+    }
+
+    void testRecording() {
+      color("yellow", "\nRecording Tests:", true);
+
+      Profiler::reset();
+      RoundRobin rrScheduler;
+      Process* p = new Process("Process1", 1);
+      rrScheduler.addProcess(p);
+      rrScheduler.schedule();
+      rrScheduler.executeQuantum();
+      delete p;
+
+      std::stringstream summary;
+      Profiler::printSummary(summary);
+#ifdef SCHEDULER_PROFILING
+      printTestResult(summary.str().find("selectNextProcess: 1 llamadas") != std::string::npos, "Summary should count selectNextProcess calls");
+      printTestResult(summary.str().find("executeQuantum: 1 llamadas") != std::string::npos, "Summary should count executeQuantum calls");
+      std::string traceFile = "profileTest.json";
+      printTestResult(Profiler::writeChromeTrace(traceFile), "Profiler should write a Chrome trace");
+      std::ifstream trace(traceFile);
+      std::stringstream contents;
+      contents << trace.rdbuf();
+      printTestResult(contents.str().find("\"ph\":\"X\"") != std::string::npos, "Chrome trace should contain complete events");
+      remove(traceFile.c_str());
+#else
+      printTestResult(summary.str().find("PROFILE=1") != std::string::npos, "Summary should explain how to enable profiling");
+#endif
+    }
+};
+
+class TimelineTests : public Tests {
+  public:
+    void runAllTests() override {
+      color("cyan", "\n=== Timeline Class Tests ===", true);
+
+      testCoalescing();
+      testExport();
+      testSchedulerTimeline();
+
+      printTestSummary();
+    }
+
+    void testCoalescing() {
+      color("yellow", "\nCoalescing Tests:", true);
+
+      Timeline timeline;
+      int track = timeline.addTrack("p1");
+      timeline.transition(track, TimelineState::READY, 0);
+      timeline.transition(track, TimelineState::RUNNING, 1);
+      timeline.transition(track, TimelineState::RUNNING, 2);
+      printTestResult(timeline.getIntervalCount() == 1, "Repeating the open state should not close an interval");
+
+      timeline.transition(track, TimelineState::READY, 5);
+      timeline.transition(track, TimelineState::RUNNING, 5);
+      timeline.transition(track, TimelineState::BLOCKED, 8);
+      printTestResult(timeline.getIntervalCount() == 2, "An empty interval should be dropped and its neighbours merged");
+      printTestResult(timeline.getInterval(1).start == 1 && timeline.getInterval(1).end == 8, "Merged interval should span both runs");
+
+      timeline.transition(track, TimelineState::NONE, 10);
+      timeline.close(20);
+      printTestResult(timeline.getIntervalCount() == 3, "Finishing should close the last interval");
+      printTestResult(timeline.getEnd() == 10, "Closing should not extend finished tracks");
+      timeline.transition(7, TimelineState::READY, 0);
+      printTestResult(timeline.getIntervalCount() == 3, "Unknown tracks should be ignored");
+    }
+
+    void testExport() {
+      color("yellow", "\nExport Tests:", true);
+
+      Timeline timeline;
+      int first = timeline.addTrack("p<1>");
+      int second = timeline.addTrack("p\"2");
+      timeline.transition(first, TimelineState::RUNNING, 0);
+      timeline.transition(second, TimelineState::READY, 0);
+      timeline.transition(first, TimelineState::BLOCKED, 2);
+      timeline.transition(second, TimelineState::RUNNING, 2);
+      timeline.close(3);
+
+      std::stringstream gantt;
+      timeline.writeGantt(gantt);
+      printTestResult(gantt.str().find("<svg") != std::string::npos, "Gantt should be an SVG chart");
+      printTestResult(gantt.str().find("p&lt;1>") != std::string::npos, "Gantt should escape process names");
+      printTestResult(gantt.str().find("CPU 0") != std::string::npos, "Gantt should have a row per CPU");
+
+      std::stringstream trace;
+      timeline.writeChromeTrace(trace);
+      printTestResult(trace.str().find("\"traceEvents\"") != std::string::npos, "Trace should be Chrome trace JSON");
+      printTestResult(trace.str().find("p\\\"2") != std::string::npos, "Trace should escape process names");
+      printTestResult(trace.str().find("\"name\":\"BLOCKED\",\"cat\":\"proceso\",\"ph\":\"X\",\"pid\":2,\"tid\":0,\"ts\":2000000,\"dur\":1000000")
+        != std::string::npos, "Trace should have each interval in microseconds");
+
+      // en corridas largas se conservan los microsegundos y los intervalos contiguos no se traslapan
+      Timeline longRun;
+      int track = longRun.addTrack("largo");
+      longRun.transition(track, TimelineState::READY, 97.500001);
+      longRun.transition(track, TimelineState::RUNNING, 97.500003);
+      longRun.close(97.600004);
+      std::stringstream longTrace;
+      longRun.writeChromeTrace(longTrace);
+      printTestResult(longTrace.str().find("\"ts\":97500001,\"dur\":2}") != std::string::npos
+        && longTrace.str().find("\"ts\":97500003,\"dur\":100001}") != std::string::npos
+        && longTrace.str().find("e+") == std::string::npos, "Trace should keep microsecond precision on long runs");
+      std::stringstream longGantt;
+      longRun.writeGantt(longGantt);
+      printTestResult(longGantt.str().find("[97.500001, 97.500003)") != std::string::npos, "Gantt titles should keep microsecond precision");
+    }
+
+    /// @brief Corre pruebas.txt en tiempo virtual con una linea de tiempo
+    /// @return La cantidad de intervalos registrados; -1 si dos procesos corrieron a la vez en el CPU
+    int runWithTimeline(bool instructionTrace) {
+      SimulationClock::setVirtual(true);
+      SimulationClock::reset();
+      RoundRobin scheduler;
+      scheduler.setInstructionTrace(instructionTrace);
+      scheduler.setTimeline(new Timeline());
+      FileParser parser;
+      parser.parseFile("database/pruebas.txt");
+      scheduler.setDevices(parser.getCostModel());
+      scheduler.addProcesses(*parser.getProcesses());
+      std::stringstream buffer;
+      std::streambuf* oldCout = std::cout.rdbuf(buffer.rdbuf());
+      scheduler.run();
+      std::cout.rdbuf(oldCout);
+      SimulationClock::setVirtual(false);
+
+      const Timeline& timeline = *scheduler.getTimeline();
+      double lastEnd = 0;
+      for (int index = 0; index < timeline.getIntervalCount(); index++) {
+        const TimelineInterval& interval = timeline.getInterval(index);
+        if (interval.state == TimelineState::RUNNING) {
+          if (interval.start < lastEnd) {
+            return -1;
+          }
+          lastEnd = interval.end;
+        }
+      }
+      return timeline.getIntervalCount();
+    }
+
+    void testSchedulerTimeline() {
+      color("yellow", "\nScheduler Timeline Tests:", true);
+
+      int batched = runWithTimeline(false);
+      printTestResult(batched > 0, "Scheduler should record intervals without overlapping runs on the CPU");
+      printTestResult(runWithTimeline(true) == batched, "Interval count should not depend on per-instruction execution");
+    }
+};
+
+class StatusServerTests : public Tests {
+  public:
+    void runAllTests() override {
+      color("cyan", "\n=== StatusServer Class Tests ===", true);
+
+      testSeqlock();
+      if (!StatusServer::isSupported()) {
+        color("yellow", "Status server not supported on this platform; skipping", true);
+        printTestSummary();
+        return;
+      }
+      testServer();
+      testLiveScheduler();
+
+      printTestSummary();
+    }
+
+    /// @brief Dato de prueba del seqlock: una lectura consistente tiene todos sus campos iguales
+    struct Sample {
+      unsigned long long first;
+      double middle[5];
+      int last;
+    };
+
+    void testSeqlock() {
+      color("yellow", "\nSeqlock Tests:", true);
+
+      Seqlock<Sample> seqlock;
+      Sample initial = seqlock.read();
+      printTestResult(initial.first == 0 && initial.last == 0 && seqlock.getVersion() == 0, "Seqlock should start with a value-initialized value");
+
+      // un escritor publica sin parar mientras varios lectores copian; ninguna copia aceptada puede mezclar dos escrituras
+      const int writes = 200000;
+      std::atomic<bool> done(false);
+      std::atomic<bool> torn(false);
+      std::atomic<unsigned long long> reads(0);
+      std::thread readers[3];
+      for (int t = 0; t < 3; t++) {
+        readers[t] = std::thread([&]() {
+          while (!done.load()) {
+            Sample sample = seqlock.read();
+            bool consistent = sample.last == (int) sample.first;
+            for (double value : sample.middle) {
+              consistent = consistent && value == (double) sample.first;
+            }
+            if (!consistent) {
+              torn.store(true);
+            }
+            reads.fetch_add(1);
+          }
+        });
+      }
+      for (int i = 1; i <= writes; i++) {
+        Sample sample;
+        sample.first = i;
+        for (double& value : sample.middle) {
+          value = i;
+        }
+        sample.last = i;
+        seqlock.write(sample);
+      }
+      done.store(true);
+      for (int t = 0; t < 3; t++) {
+        readers[t].join();
+      }
+      printTestResult(!torn.load() && reads.load() > 0, "Concurrent readers should never see a torn value");
+      printTestResult(seqlock.getVersion() == (unsigned long long) writes && seqlock.read().last == writes, "Seqlock should keep the last value written");
+    }
+
+    void testServer() {
+      color("yellow", "\nServer Tests:", true);
+
+      std::string path = "statusTest.sock";
+      StatusServer server(path);
+      printTestResult(server.start(), "Server should listen on a UNIX socket");
+      StatusSnapshot snapshot = {};
+      snapshot.quantums = 7;
+      snapshot.ready = 3;
+      std::strcpy(snapshot.policy, "Round \"Robin\"");
+      std::strcpy(snapshot.current, "p1");
+      server.publish(snapshot);
+      std::string response;
+      bool answered = StatusServer::query(path, response);
+      printTestResult(answered && response.find("HTTP/1.0 200 OK") == 0, "Server should answer with an HTTP response");
+      printTestResult(response.find("\"quantums\":7") != std::string::npos && response.find("\"ready\":3") != std::string::npos
+        && response.find("\"current\":\"p1\"") != std::string::npos, "Response should carry the last published snapshot");
+      printTestResult(response.find("Round \\\"Robin\\\"") != std::string::npos, "Names should be escaped in the JSON");
+      printTestResult(server.getServedCount() == 1, "Server should count the connections it answered");
+      server.stop();
+      printTestResult(!StatusServer::query(path, response), "Stopped server should not accept connections");
+
+      // un archivo que no es un socket no se borra: el servidor no arranca
+      std::ofstream precious(path);
+      precious << "no borrar";
+      precious.close();
+      StatusServer blocked(path);
+      std::stringstream errors;
+      std::streambuf* oldCerr = std::cerr.rdbuf(errors.rdbuf());
+      bool started = blocked.start();
+      std::cerr.rdbuf(oldCerr);
+      std::ifstream kept(path);
+      std::string contents;
+      std::getline(kept, contents);
+      printTestResult(!started && contents == "no borrar", "Server should refuse to replace a file that is not a socket");
+      kept.close();
+      remove(path.c_str());
+
+      // un socket viejo si se reemplaza, y quien lo creo no borra el del servidor nuevo al detenerse
+      StatusServer stale(path);
+      StatusServer replacement(path);
+      bool replaced = stale.start() && replacement.start();
+      stale.stop();
+      printTestResult(replaced && StatusServer::query(path, response), "Stopping should not remove a socket another server created");
+      replacement.stop();
+      printTestResult(!StatusServer::query(path, response), "Server should remove the socket it created");
+    }
+
+    void testLiveScheduler() {
+      color("yellow", "\nLive Scheduler Tests:", true);
+
+      std::string path = "statusTest.sock";
+      SimulationClock::setVirtual(true);
+      SimulationClock::reset();
+      RoundRobin scheduler;
+      scheduler.setInstructionTrace(false);
+      StatusServer* server = new StatusServer(path);
+      server->start();
+      scheduler.setStatusServer(server);
+      for (int i = 0; i < 20; i++) {
+        Process process("p" + std::to_string(i), 1);
+        for (int j = 0; j < 200; j++) {
+          process.addInstruction(j % 50 == 0 ? "e/s" : "instruccion");
+        }
+        scheduler.addProcess(&process);
+      }
+
+      // un cliente consulta sin parar mientras el planificador corre; la corrida no lo espera
+      std::atomic<bool> running(true);
+      std::atomic<int> answers(0);
+      std::atomic<bool> valid(true);
+      std::thread client([&]() {
+        while (running.load()) {
+          std::string response;
+          if (StatusServer::query(path, response)) {
+            answers.fetch_add(1);
+            if (response.find("\"policy\":\"Round Robin\"") == std::string::npos) {
+              valid.store(false);
+            }
+          }
+        }
+      });
+      std::stringstream buffer;
+      std::streambuf* oldCout = std::cout.rdbuf(buffer.rdbuf());
+      scheduler.run();
+      std::cout.rdbuf(oldCout);
+      StatusSnapshot last = server->getSnapshot();
+      running.store(false);
+      client.join();
+      SimulationClock::setVirtual(false);
+      printTestResult(last.finished && last.finishedProcesses == 20 && last.ready == 0 && last.current[0] == '\0',
+        "Last snapshot should show the finished run");
+      printTestResult(last.quantums > 20 && last.waiting.count == 20, "Scheduler should publish once per quantum with its histograms");
+      const LatencyHistogram& waiting = scheduler.getWaitingHistogram();
+      const LatencyHistogram& blocked = scheduler.getBlockedHistogram();
+      printTestResult(last.waiting.p99 == waiting.getPercentile(99) && last.blockedTime.count == blocked.getCount()
+        && last.blockedTime.p50 == blocked.getPercentile(50), "Last snapshot should carry up-to-date percentiles");
+      printTestResult(valid.load(), "Every answer during the run should be a snapshot of the scheduler");
+      std::string response;
+      printTestResult(StatusServer::query(path, response) && response.find("\"finished\":true") != std::string::npos,
+        "Server should keep serving the last snapshot after the run");
+    }
+};
+
+class GoldenTraceTests : public Tests {
+  private:
+    bool update;
+
+  public:
+    /// @brief Constructor parametrizado
+    /// @param newUpdate true para reescribir las trazas de referencia en lugar de compararlas
+    GoldenTraceTests(bool newUpdate = false) : update(newUpdate) {}
+
+    void runAllTests() override {
+      color("cyan", "\n=== Golden Trace Tests ===", true);
+
+      testGoldenTraces();
+
+      printTestSummary();
+    }
+
+    /// @brief Busca las cargas de trabajo de database/, para que un archivo nuevo quede cubierto sin tocar las pruebas.
+    /// @return Los nombres de los archivos .txt, sin la extension, en orden alfabetico
+    static SinglyLinkedList<std::string> workloads() {
+      SinglyLinkedList<std::string> names;
+      std::error_code error;
+      for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator("database", error)) {
+        if (entry.is_regular_file() && entry.path().extension() == ".txt") {
+          names.insertTail(entry.path().stem().string());
+        }
+      }
+      names.sortBy([](const std::string& a, const std::string& b) { return a < b; });
+      return names;
+    }
+
+    /// @brief Corre un archivo de procesos en modo deterministico, igual que main con --deterministic.
+    /// @param dynamicDispatch true para correr el ciclo generico de Scheduler en lugar del especializado
+    /// @return La traza de eventos
+    std::string runDeterministic(const std::string& filename, const std::string& policy, bool instructionTrace, bool dynamicDispatch = false) {
+      SimulationClock::setVirtual(true);
+      SimulationClock::reset();
+      Scheduler* scheduler = UI::createScheduler(policy);
+      scheduler->setInstructionTrace(instructionTrace);
+      scheduler->setDynamicDispatch(dynamicDispatch);
+      scheduler->setSeed(0);
+      std::stringstream trace;
+      scheduler->setEventTrace(&trace);
+
+      FileParser parser;
+      parser.parseFile(filename);
+      scheduler->setDevices(parser.getCostModel());
+      scheduler->addProcesses(*parser.getProcesses());
+      std::stringstream buffer;
+      std::streambuf* oldCout = std::cout.rdbuf(buffer.rdbuf());
+      scheduler->run();
+      std::cout.rdbuf(oldCout);
+
+      delete scheduler;
+      SimulationClock::setVirtual(false);
+      return trace.str();
+    }
+
+    void testGoldenTraces() {
+      color("yellow", "\nGolden Trace Tests:", true);
+
+      // un archivo sin traza de referencia falla hasta correr make golden-update
+      SinglyLinkedList<std::string> files = workloads();
+      printTestResult(files.getSize() > 0, "database/ should have workloads to compare");
+      const char* policies[] = {"rr", "prioridad", "edf", "rm"};
+      for (const std::string& file : files) {
+        for (const char* policy : policies) {
+          std::string name = file + "." + policy;
+          std::string goldenFile = "unit-tests/golden/" + name + ".trace";
+          std::string trace = runDeterministic("database/" + file + ".txt", policy, false);
+          if (update) {
+            std::ofstream golden(goldenFile);
+            golden << trace;
+            printTestResult(golden.good(), "Golden trace written: " + name);
+            continue;
+          }
+          std::ifstream golden(goldenFile);
+          std::stringstream expected;
+          expected << golden.rdbuf();
+          printTestResult(golden.is_open() && !trace.empty() && trace == expected.str(), "Trace should match its golden trace: " + name);
+          printTestResult(runDeterministic("database/" + file + ".txt", policy, true) == trace,
+            "Per-instruction execution should give the same trace: " + name);
+        }
+      }
+      if (!update) {
+        testFractionalCosts(policies);
+      }
+    }
+
+    /// @brief Compara la ejecucion por rafagas con la traza por instruccion cuando los costos no son enteros: database/ solo usa
+    /// costos enteros, asi que ahi no se nota el redondeo de sumar los costos en distinto orden.
+    void testFractionalCosts(const char* const (&policies)[4]) {
+      std::string testFilename = "testFractional.txt";
+      const char* headers[] = {"costo predeterminado 0.05\n", "costo instruccion lenta 1.7\ncosto predeterminado 0.7\n"};
+      const char* names[] = {"0.05", "0.7/1.7"};
+      for (int workload = 0; workload < 2; ++workload) {
+        std::ofstream outFile(testFilename);
+        outFile << headers[workload];
+        outFile << "proceso Larga 0\n";
+        for (int instruction = 0; instruction < 200; ++instruction) {
+          outFile << (instruction % 3 == 2 ? "instruccion lenta\n" : "instruccion 1\n");
+        }
+        outFile << "fin proceso\n";
+        outFile << "proceso Corta 1\ninstruccion 1\ne/s\ne/s\ninstruccion lenta\nfin proceso\n";
+        outFile.close();
+
+        for (const char* policy : policies) {
+          std::string trace = runDeterministic(testFilename, policy, false);
+          printTestResult(!trace.empty() && runDeterministic(testFilename, policy, true) == trace,
+            std::string("Per-instruction execution should give the same trace with fractional costs: ") + names[workload] + "." + policy);
+        }
+      }
+      remove(testFilename.c_str());
+    }
+};
+
+class SchedulerCoreTests : public Tests {
+  public:
+    void runAllTests() override {
+      color("cyan", "\n=== Scheduler Core Tests ===", true);
+
+      testDispatchEquivalence();
+      testRemoveReady();
+
+      printTestSummary();
+    }
+
+    void testDispatchEquivalence() {
+      color("yellow", "\nDispatch Equivalence Tests:", true);
+
+      RoundRobin rr;
+      printTestResult(!rr.hasDynamicDispatch(), "Schedulers should run the specialized loop by default");
+
+      GoldenTraceTests golden;
+      const char* policies[] = {"rr", "prioridad", "edf", "rm"};
+      for (const std::string& file : GoldenTraceTests::workloads()) {
+        for (const char* policy : policies) {
+          std::string filename = "database/" + file + ".txt";
+          std::string specialized = golden.runDeterministic(filename, policy, false);
+          printTestResult(!specialized.empty() && golden.runDeterministic(filename, policy, false, true) == specialized,
+            "Generic loop should give the same trace as the specialized one: " + file + "." + policy);
+        }
+      }
+    }
+
+    void testRemoveReady() {
+      color("yellow", "\nRemove Ready Process Tests:", true);
+
+      SimulationClock::reset();
+      Priority priority;
+      Process* p1 = new Process("Process1", 3);
+      Process* p2 = new Process("Process2", 5);
+      priority.addProcess(p1);
+      priority.addProcess(p2);
+      priority.removeProcess(p1);
+      printTestResult(priority.getReadyCount() == 1, "Priority should remove a ready process from its tree");
+      priority.schedule();
+      printTestResult(priority.getCurrent() && priority.getCurrent()->getName() == "Process2", "Priority should schedule the remaining process");
+
+      SimulationClock::reset();
+      EarliestDeadlineFirst edf;
+      Process* p3 = new Process("Process3", 1);
+      edf.addProcess(p3);
+      edf.addProcess(p2);
+      edf.removeProcess(p3);
+      printTestResult(edf.getReadyCount() == 1, "Real-time schedulers should remove a ready process from their heap");
+      delete p1;
+      delete p2;
+      delete p3;
+    }
+};
+
+/// @brief Mide el ciclo especializado contra el generico de cada algoritmo sobre una carga sintetica o un archivo de procesos.
+/// Corre en tiempo virtual y sin salida, para medir solo el planificador.
+class SchedulerBenchmark {
+  private:
+    /// @brief Escribe una carga sintetica con muchos procesos cortos, mezcla de instrucciones y E/S.
+    static void writeWorkload(const std::string& filename) {
+      std::ofstream outFile(filename);
+      outFile << "latencia 2\n";
+      for (int i = 0; i < 1500; i++) {
+        outFile << "proceso p" << i << " " << i % 10 << " plazo " << 40 + i % 200 << "\n";
+        for (int j = 0; j < 8 + i % 24; j++) {
+          outFile << (j % 7 == 4 ? "e/s" : "instruccion " + std::to_string(j % 7)) << "\n";
+        }
+        outFile << "fin proceso\n";
+      }
+    }
+
+    /// @brief Corre una vez el algoritmo sobre los procesos dados.
+    /// @return Milisegundos que tardo run()
+    static double timeRun(const std::string& policy, FileParser& parser, bool dynamicDispatch) {
+      SimulationClock::setVirtual(true);
+      SimulationClock::reset();
+      Scheduler* scheduler = UI::createScheduler(policy);
+      scheduler->setInstructionTrace(false);
+      scheduler->setDynamicDispatch(dynamicDispatch);
+      scheduler->setDevices(parser.getCostModel());
+      scheduler->addProcesses(*parser.getProcesses());
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+      scheduler->run();
+      double elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+      delete scheduler;
+      SimulationClock::setVirtual(false);
+      return elapsed;
+    }
+
+  public:
+    /// @brief Imprime el mejor tiempo de cada ciclo por algoritmo.
+    /// @param filename Archivo de procesos; vacio para usar la carga sintetica
+    /// @param repetitions Corridas por ciclo y algoritmo
+    static void run(std::string filename, int repetitions) {
+      bool synthetic = filename.empty();
+      if (synthetic) {
+        filename = "benchmarkInput.txt";
+        writeWorkload(filename);
+      }
+      FileParser parser;
+      bool loaded = parser.parseFile(filename);
+      if (synthetic) {
+        remove(filename.c_str());
+      }
+      if (!loaded) {
+        return;
+      }
+
+      color("cyan", "\n=== Scheduler Benchmark ===", true);
+      std::cout << parser.getProcesses()->getSize() << " processes, best of " << repetitions << " runs\n";
+      const char* policies[] = {"rr", "prioridad", "edf", "rm"};
+      for (const char* policy : policies) {
+        double best[2] = {0, 0};
+        for (int i = 0; i < repetitions; i++) {
+          for (int dynamic = 0; dynamic < 2; dynamic++) {
+            // la salida por quantum se descarta con badbit para que no domine la medicion
+            std::cout.setstate(std::ios::badbit);
+            double elapsed = timeRun(policy, parser, dynamic);
+            std::cout.clear();
+            if (i == 0 || elapsed < best[dynamic]) {
+              best[dynamic] = elapsed;
+            }
+          }
+        }
+        std::cout << policy << ": specialized " << best[0] << " ms, generic " << best[1] << " ms, speedup "
+          << (best[0] > 0 ? best[1] / best[0] : 0) << "x\n";
+      }
+    }
+};
+
 class TestRunner {
 	public:
-		static void runAll() {
+		/// @brief Corre todas las clases de pruebas.
+		/// @return true si pasaron todas las pruebas; false si no
+		static bool runAll() {
 			color("cyan", "\n=== Starting All Unit Tests ===\n", true);
 			
 			ProcessTests processTests;
+			InstructionDictionaryTests instructionDictionaryTests;
 			TimerTests timerTests;
 			UITests uiTests;
 			FileParserTests fileParserTests;
 			SchedulerTests schedulerTests;
+			NativeBackendTests nativeBackendTests;
+			SinglyLinkedListTests singlyLinkedListTests;
+			BinarySearchTreeTests binarySearchTreeTests;
+			BinaryHeapTests binaryHeapTests;
+			LatencyHistogramTests latencyHistogramTests;
+			ProfilerTests profilerTests;
+			TimelineTests timelineTests;
+			StatusServerTests statusServerTests;
+			GoldenTraceTests goldenTraceTests;
+			SchedulerCoreTests schedulerCoreTests;
 
 			processTests.runAllTests();
+			instructionDictionaryTests.runAllTests();
 			timerTests.runAllTests();
 			uiTests.runAllTests();
 			fileParserTests.runAllTests();
 			schedulerTests.runAllTests();
+			nativeBackendTests.runAllTests();
+			singlyLinkedListTests.runAllTests();
+			binarySearchTreeTests.runAllTests();
+			binaryHeapTests.runAllTests();
+			latencyHistogramTests.runAllTests();
+			profilerTests.runAllTests();
+			timelineTests.runAllTests();
+			statusServerTests.runAllTests();
+			goldenTraceTests.runAllTests();
+			schedulerCoreTests.runAllTests();
 
 			color("cyan", "\n=== All Unit Tests Completed ===\n", true);
+			return processTests.allPassed() && instructionDictionaryTests.allPassed() && timerTests.allPassed() && uiTests.allPassed()
+				&& fileParserTests.allPassed() && schedulerTests.allPassed() && nativeBackendTests.allPassed() && singlyLinkedListTests.allPassed()
+				&& binarySearchTreeTests.allPassed() && binaryHeapTests.allPassed() && latencyHistogramTests.allPassed() && profilerTests.allPassed()
+				&& timelineTests.allPassed() && statusServerTests.allPassed() && goldenTraceTests.allPassed() && schedulerCoreTests.allPassed();
 		}
 };
 
-int main() {
-	TestRunner::runAll();
-	return 0;
+int main(int argc, char* argv[]) {
+	// "tests golden" corre solo las trazas de referencia; "tests golden --update" las reescribe.
+	// Si falla alguna prueba el estado de salida no es 0, para que make golden-test y make test fallen
+	if (argc > 1 && std::string(argv[1]) == "golden") {
+		GoldenTraceTests goldenTraceTests(argc > 2 && std::string(argv[2]) == "--update");
+		goldenTraceTests.runAllTests();
+		return goldenTraceTests.allPassed() ? 0 : 1;
+	}
+	// "tests benchmark [archivo] [repeticiones]" compara el ciclo especializado contra el generico
+	if (argc > 1 && std::string(argv[1]) == "benchmark") {
+		SchedulerBenchmark::run(argc > 2 ? argv[2] : "", argc > 3 ? std::atoi(argv[3]) : 5);
+		return 0;
+	}
+	return TestRunner::runAll() ? 0 : 1;
 }
\ No newline at end of file